@@ -0,0 +1,121 @@
+#include "ArchivoMapeado.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace URGArchivoMapeado {
+	struct ArchivoMapeado {
+		const char* datos = nullptr;
+		size_t tamanio = 0;
+#ifdef _WIN32
+		HANDLE archivo = INVALID_HANDLE_VALUE;
+		HANDLE mapeo = nullptr;
+#endif
+	};
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Si @nombreArchivo existe y se puede leer devuelve una instancia de ArchivoMapeado con todo su contenido.
+	 * Si no se puede abrir o mapear devuelve NULL. Un archivo vacio se mapea con tamanio cero
+	 */
+	ArchivoMapeado* MapearArchivo(const string& nombreArchivo) {
+#ifdef _WIN32
+		HANDLE archivo = CreateFileA(nombreArchivo.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (archivo == INVALID_HANDLE_VALUE) {
+			return nullptr;
+		}
+		LARGE_INTEGER tamanio;
+		if (!GetFileSizeEx(archivo, &tamanio)) {
+			CloseHandle(archivo);
+			return nullptr;
+		}
+
+		ArchivoMapeado* mapeado = new ArchivoMapeado;
+		mapeado->archivo = archivo;
+		mapeado->tamanio = static_cast<size_t>(tamanio.QuadPart);
+		if (mapeado->tamanio > 0) {
+			mapeado->mapeo = CreateFileMappingA(archivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			void* datos = mapeado->mapeo ? MapViewOfFile(mapeado->mapeo, FILE_MAP_READ, 0, 0, 0) : nullptr;
+			if (datos == nullptr) {
+				DestruirArchivoMapeado(mapeado);
+				return nullptr;
+			}
+			mapeado->datos = static_cast<const char*>(datos);
+		}
+		return mapeado;
+#else
+		int descriptor = open(nombreArchivo.c_str(), O_RDONLY);
+		if (descriptor < 0) {
+			return nullptr;
+		}
+		struct stat estado;
+		if (fstat(descriptor, &estado) != 0) {
+			close(descriptor);
+			return nullptr;
+		}
+
+		ArchivoMapeado* mapeado = new ArchivoMapeado;
+		mapeado->tamanio = static_cast<size_t>(estado.st_size);
+		if (mapeado->tamanio > 0) {
+			void* datos = mmap(nullptr, mapeado->tamanio, PROT_READ, MAP_PRIVATE, descriptor, 0);
+			if (datos == MAP_FAILED) {
+				close(descriptor);
+				delete mapeado;
+				return nullptr;
+			}
+			mapeado->datos = static_cast<const char*>(datos);
+		}
+		// El mapeo sigue siendo valido despues de cerrar el descriptor
+		close(descriptor);
+		return mapeado;
+#endif
+	}
+
+	/*
+	 * Precondicion: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondicion: Devuelve el primer byte del contenido de @archivo (NULL si esta vacio). Es valido hasta destruir @archivo
+	 */
+	const char* ObtenerDatos(const ArchivoMapeado* archivo) {
+		return archivo->datos;
+	}
+
+	/*
+	 * Precondicion: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondicion: Devuelve la cantidad de bytes de @archivo
+	 */
+	size_t ObtenerTamanio(const ArchivoMapeado* archivo) {
+		return archivo->tamanio;
+	}
+
+	/*
+	 * Precondiciones: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondiciones: Libera el mapeo y todos los recursos asociados a @archivo
+	 */
+	void DestruirArchivoMapeado(ArchivoMapeado* archivo) {
+		if (archivo == nullptr) {
+			return;
+		}
+#ifdef _WIN32
+		if (archivo->datos != nullptr) {
+			UnmapViewOfFile(archivo->datos);
+		}
+		if (archivo->mapeo != nullptr) {
+			CloseHandle(archivo->mapeo);
+		}
+		if (archivo->archivo != INVALID_HANDLE_VALUE) {
+			CloseHandle(archivo->archivo);
+		}
+#else
+		if (archivo->datos != nullptr) {
+			munmap(const_cast<char*>(archivo->datos), archivo->tamanio);
+		}
+#endif
+		delete archivo;
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef ARCHIVOMAPEADO_H_
+#define ARCHIVOMAPEADO_H_
+
+#include <cstddef>
+#include <string>
+using std::string;
+
+namespace URGArchivoMapeado{
+	/*
+	 * Archivo de solo lectura mapeado en memoria (mmap en POSIX, MapViewOfFile en Windows).
+	 * Los datos se leen directamente de las paginas del archivo, sin copiarlos
+	 */
+	struct ArchivoMapeado;
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Si @nombreArchivo existe y se puede leer devuelve una instancia de ArchivoMapeado con todo su contenido.
+	 * Si no se puede abrir o mapear devuelve NULL. Un archivo vacio se mapea con tamanio cero
+	 */
+	ArchivoMapeado* MapearArchivo(const string& nombreArchivo);
+
+	/*
+	 * Precondicion: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondicion: Devuelve el primer byte del contenido de @archivo (NULL si esta vacio). Es valido hasta destruir @archivo
+	 */
+	const char* ObtenerDatos(const ArchivoMapeado* archivo);
+
+	/*
+	 * Precondicion: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondicion: Devuelve la cantidad de bytes de @archivo
+	 */
+	size_t ObtenerTamanio(const ArchivoMapeado* archivo);
+
+	/*
+	 * Precondiciones: @archivo es una instancia valida creada con MapearArchivo
+	 * Postcondiciones: Libera el mapeo y todos los recursos asociados a @archivo
+	 */
+	void DestruirArchivoMapeado(ArchivoMapeado* archivo);
+}
+
+#endif
@@ -1,11 +1,297 @@
 #include "Escritor.h"
+#include "EscrituraUring.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace URGEscritor {
+    typedef std::chrono::steady_clock Reloj;
+
+    static size_t CubetaLatencia(unsigned long long nanosegundos) {
+        if (nanosegundos < 16) {
+            return static_cast<size_t>(nanosegundos);
+        }
+        int exponente = 63;
+        while ((nanosegundos >> exponente) == 0) {
+            --exponente;
+        }
+        size_t subcubeta = static_cast<size_t>(nanosegundos >> (exponente - 4)) - 16;
+        return 16 + static_cast<size_t>(exponente - 4) * 16 + subcubeta;
+    }
+
+    // Mayor latencia que cae en @cubeta
+    static unsigned long long LimiteCubeta(size_t cubeta) {
+        if (cubeta < 16) {
+            return cubeta;
+        }
+        size_t corrimiento = (cubeta - 16) / 16;
+        unsigned long long inferior = static_cast<unsigned long long>(16 + (cubeta - 16) % 16) << corrimiento;
+        return inferior + ((1ULL << corrimiento) - 1);
+    }
+
+    static void RegistrarEscrituraDestino(EstadisticasEscritor* estadisticas, unsigned long long nanosegundos) {
+        if (estadisticas->escriturasDestino == 0 || nanosegundos < estadisticas->latenciaMinima) {
+            estadisticas->latenciaMinima = nanosegundos;
+        }
+        estadisticas->latenciaMaxima = std::max(estadisticas->latenciaMaxima, nanosegundos);
+        ++estadisticas->escriturasDestino;
+        estadisticas->nanosegundosDestino += nanosegundos;
+        ++estadisticas->cubetas[CubetaLatencia(nanosegundos)];
+    }
+
+    static unsigned long long NanosegundosDesde(Reloj::time_point inicio) {
+        return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(Reloj::now() - inicio).count());
+    }
+
+    // Aviso de EscrituraUring: la latencia es desde que se envio el buffer hasta que el kernel termino de escribirlo
+    static void RegistrarEscrituraUring(size_t, unsigned long long nanosegundos, void* contexto) {
+        RegistrarEscrituraDestino(static_cast<EstadisticasEscritor*>(contexto), nanosegundos);
+    }
+
+    struct BloqueEscritura {
+        std::vector<char> datos;
+        size_t usado = 0;
+    };
+
+    /*
+     * Cola de bloques de un productor y un consumidor, sin locks: cada indice lo escribe un solo hilo.
+     * Tiene lugar para capacidad - 1 bloques (una ranura queda libre para distinguir llena de vacia)
+     */
+    struct ColaBloques {
+        std::vector<BloqueEscritura> ranuras;
+        std::atomic<size_t> lectura{ 0 };
+        std::atomic<size_t> escritura{ 0 };
+    };
+
+    static bool PonerBloque(ColaBloques& cola, BloqueEscritura& bloque) {
+        size_t escritura = cola.escritura.load(std::memory_order_relaxed);
+        size_t siguiente = (escritura + 1) % cola.ranuras.size();
+        if (siguiente == cola.lectura.load(std::memory_order_acquire)) {
+            return false;
+        }
+        cola.ranuras[escritura] = std::move(bloque);
+        cola.escritura.store(siguiente, std::memory_order_release);
+        return true;
+    }
+
+    static bool SacarBloque(ColaBloques& cola, BloqueEscritura& bloque) {
+        size_t lectura = cola.lectura.load(std::memory_order_relaxed);
+        if (lectura == cola.escritura.load(std::memory_order_acquire)) {
+            return false;
+        }
+        bloque = std::move(cola.ranuras[lectura]);
+        cola.lectura.store((lectura + 1) % cola.ranuras.size(), std::memory_order_release);
+        return true;
+    }
+
+    /*
+     * Estado de un escritor asincronico: el hilo que escribe llena un buffer mientras el hilo de E/S escribe en el
+     * archivo los que recibio por llenos y los devuelve por vacios. La cantidad fija de buffers pone el limite:
+     * si no vuelve ninguno vacio el productor espera (contrapresion)
+     */
+    struct SalidaAsincrona {
+        ColaBloques llenos;
+        ColaBloques vacios;
+        std::thread hilo;
+        std::atomic<bool> terminar{ false };
+        std::atomic<bool> error{ false };
+        std::atomic<unsigned long long> enviados{ 0 };
+        std::atomic<unsigned long long> escritos{ 0 };
+        // Todo cambio que pueda despertar al otro hilo se hace con el mutex tomado (ver Avisar)
+        std::mutex mutex;
+        std::condition_variable cambio;
+    };
+
+    /*
+     * Espera sin timeout a que @condicion sea verdadera. Si ya lo es no toma el mutex; si no, la vuelve a evaluar
+     * con el mutex tomado, asi ningun aviso puede caer entre la consulta y la espera
+     */
+    template <typename Condicion>
+    static void EsperarHasta(SalidaAsincrona* salida, Condicion condicion) {
+        if (condicion()) {
+            return;
+        }
+        std::unique_lock<std::mutex> bloqueo(salida->mutex);
+        salida->cambio.wait(bloqueo, condicion);
+    }
+
+    // Aplica @cambio y avisa al otro hilo, las dos cosas con el mutex tomado
+    template <typename Cambio>
+    static void Avisar(SalidaAsincrona* salida, Cambio cambio) {
+        std::lock_guard<std::mutex> bloqueo(salida->mutex);
+        cambio();
+        salida->cambio.notify_all();
+    }
+
     struct Escritor {
         TipoEscritor tipo = CONSOLA;
         std::ofstream archivo;
+        // Buffer propio. Con tamanioBuffer en cero el escritor no acumula y vacia en cada linea (std::endl)
+        std::vector<char> buffer;
+        size_t usado = 0;
+        size_t tamanioBuffer = 0;
+        PoliticaVaciado politica = VACIAR_POR_TAMANIO;
+        size_t lineasPorVaciado = 0;
+        size_t lineasPendientes = 0;
+        SalidaAsincrona* asincrona = nullptr; // No es NULL en los escritores creados con CrearEscritorArchivoAsincrono
+        URGEscrituraUring::EscrituraUring* uring = nullptr; // Solo en los del tipo ARCHIVO_IO_URING
+        // Solo en los del tipo MEMORIA. Cada trozo se reserva con tamanioTrozo bytes y nunca se realoca
+        std::vector<std::vector<char>> trozos;
+        size_t tamanioTrozo = 0;
+        // NULL mientras no se llame a ActivarEstadisticas. Tambien la lee el hilo de E/S de un escritor asincronico
+        std::atomic<EstadisticasEscritor*> estadisticas{ nullptr };
     };
 
+    static void AgregarEnMemoria(Escritor* escritor, const char* datos, size_t largo) {
+        while (largo > 0) {
+            if (escritor->trozos.empty() || escritor->trozos.back().size() == escritor->tamanioTrozo) {
+                escritor->trozos.emplace_back();
+                escritor->trozos.back().reserve(escritor->tamanioTrozo);
+            }
+            std::vector<char>& trozo = escritor->trozos.back();
+            size_t copiar = std::min(largo, escritor->tamanioTrozo - trozo.size());
+            trozo.insert(trozo.end(), datos, datos + copiar);
+            datos += copiar;
+            largo -= copiar;
+        }
+    }
+
+    // Espera a que el hilo de E/S haya escrito todos los buffers que recibio
+    static void EsperarEscritos(SalidaAsincrona* salida) {
+        EsperarHasta(salida, [salida]() {
+            return salida->escritos.load(std::memory_order_acquire) == salida->enviados.load();
+        });
+    }
+
+    // Cuerpo del hilo de E/S de un escritor asincronico
+    static void EscribirBloquesPendientes(Escritor* escritor) {
+        SalidaAsincrona* salida = escritor->asincrona;
+        BloqueEscritura bloque;
+        for (;;) {
+            bool hayBloque = false;
+            EsperarHasta(salida, [&]() {
+                hayBloque = SacarBloque(salida->llenos, bloque);
+                return hayBloque || (salida->terminar.load(std::memory_order_acquire) &&
+                    salida->escritos.load() == salida->enviados.load());
+            });
+            if (!hayBloque) {
+                return;
+            }
+            EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+            Reloj::time_point inicio = estadisticas != nullptr ? Reloj::now() : Reloj::time_point();
+            if (!escritor->archivo.write(bloque.datos.data(), static_cast<std::streamsize>(bloque.usado))) {
+                salida->error.store(true);
+            }
+            // Lo lee el productor despues de Vaciar, que espera a que se publique escritos
+            if (estadisticas != nullptr) {
+                RegistrarEscrituraDestino(estadisticas, NanosegundosDesde(inicio));
+            }
+            bloque.usado = 0;
+            Avisar(salida, [&]() {
+                PonerBloque(salida->vacios, bloque);
+                salida->escritos.fetch_add(1, std::memory_order_release);
+            });
+        }
+    }
+
+    // Pasa el buffer lleno al hilo de E/S y toma uno vacio, esperando si todos estan en vuelo
+    static void EntregarBuffer(Escritor* escritor) {
+        SalidaAsincrona* salida = escritor->asincrona;
+        BloqueEscritura bloque;
+        bloque.datos.swap(escritor->buffer);
+        bloque.usado = escritor->usado;
+        escritor->usado = 0;
+        // llenos tiene lugar para todos los buffers, asi que siempre entra
+        Avisar(salida, [&]() {
+            salida->enviados.fetch_add(1);
+            PonerBloque(salida->llenos, bloque);
+        });
+        EsperarHasta(salida, [&]() { return SacarBloque(salida->vacios, bloque); });
+        escritor->buffer.swap(bloque.datos);
+    }
+
+    // Pasa @largo caracteres al destino sin pasar por el buffer propio
+    static void EscribirDestino(Escritor* escritor, const char* datos, size_t largo) {
+        EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+        Reloj::time_point inicio = estadisticas != nullptr ? Reloj::now() : Reloj::time_point();
+        if (escritor->tipo == CONSOLA) {
+            std::cout.write(datos, static_cast<std::streamsize>(largo));
+        }
+        else if (escritor->tipo == ARCHIVO) {
+            escritor->archivo.write(datos, static_cast<std::streamsize>(largo));
+        }
+        else if (escritor->tipo == MEMORIA) {
+            AgregarEnMemoria(escritor, datos, largo);
+        }
+        if (estadisticas != nullptr) {
+            RegistrarEscrituraDestino(estadisticas, NanosegundosDesde(inicio));
+        }
+    }
+
+    // Pasa lo acumulado al destino en una sola escritura
+    static void VaciarBuffer(Escritor* escritor) {
+        if (escritor->usado > 0 && escritor->asincrona != nullptr) {
+            EntregarBuffer(escritor);
+        }
+        else if (escritor->usado > 0) {
+            EscribirDestino(escritor, escritor->buffer.data(), escritor->usado);
+            escritor->usado = 0;
+        }
+    }
+
+    // Con VACIAR_NUNCA y VACIAR_AL_DESTRUIR el buffer crece en lugar de vaciarse al llenarse
+    static bool BufferCrece(const Escritor* escritor) {
+        return escritor->politica == VACIAR_NUNCA || escritor->politica == VACIAR_AL_DESTRUIR;
+    }
+
+    static void Acumular(Escritor* escritor, const char* datos, size_t largo) {
+        if (escritor->usado + largo > escritor->buffer.size()) {
+            if (BufferCrece(escritor)) {
+                escritor->buffer.resize(std::max(escritor->buffer.size() * 2, escritor->usado + largo));
+            }
+            else {
+                VaciarBuffer(escritor);
+                // Un bloque que ocupa todo el buffer pasa directo, sin copiarlo
+                if (largo >= escritor->buffer.size() && escritor->asincrona == nullptr) {
+                    EscribirDestino(escritor, datos, largo);
+                    return;
+                }
+                // El hilo de E/S solo recibe buffers propios: el bloque se reparte en buffers completos
+                while (largo >= escritor->buffer.size()) {
+                    std::memcpy(escritor->buffer.data(), datos, escritor->buffer.size());
+                    escritor->usado = escritor->buffer.size();
+                    datos += escritor->usado;
+                    largo -= escritor->usado;
+                    VaciarBuffer(escritor);
+                }
+            }
+        }
+        std::memcpy(escritor->buffer.data() + escritor->usado, datos, largo);
+        escritor->usado += largo;
+    }
+
+    static void ContarLineas(Escritor* escritor, size_t lineas) {
+        if (escritor->politica == VACIAR_CADA_N_LINEAS) {
+            escritor->lineasPendientes += lineas;
+            if (escritor->lineasPendientes >= escritor->lineasPorVaciado) {
+                Vaciar(escritor);
+            }
+        }
+    }
+
+    static void ConfigurarBuffer(Escritor* escritor, size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado) {
+        escritor->tamanioBuffer = std::max<size_t>(tamanioBuffer, 1);
+        escritor->buffer.resize(escritor->tamanioBuffer);
+        escritor->politica = politica;
+        escritor->lineasPorVaciado = std::max<size_t>(lineasPorVaciado, 1);
+    }
+
     /*
 	 * Precondicion: -
 	 * Postcondicion: Si @nombreArchivo es un nombre de archivo invalido devuelve NULL.
@@ -26,6 +312,100 @@ namespace URGEscritor {
         return escritor;
     }
 
+    /*
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorArchivo(string) pero el escritor acumula lo escrito en un buffer propio de
+	 * @tamanioBuffer bytes y lo pasa al archivo con una sola escritura segun @politica, en lugar de vaciar en cada linea.
+	 * Parametros:
+	 * 		@nombreArchivo: ruta y nombre del archivo donde se desea escribir
+	 * 		@tamanioBuffer: bytes que se acumulan antes de escribir en el archivo
+	 * 		@politica: cuando se vacia el buffer (ver PoliticaVaciado)
+	 * 		@lineasPorVaciado: cada cuantas lineas se vacia con VACIAR_CADA_N_LINEAS
+	 * 		@return: Instancia de Escritor lista para ser utilizada por las primitivas del TDA Escritor
+	 */
+    Escritor* CrearEscritorArchivo(string nombreArchivo, size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado) {
+        Escritor* escritor = new Escritor;
+        escritor->tipo = ARCHIVO;
+        // Sin el buffer del flujo: cada vaciado del buffer propio es una sola escritura al sistema operativo
+        escritor->archivo.rdbuf()->pubsetbuf(nullptr, 0);
+        escritor->archivo.open(nombreArchivo);
+
+        if (!escritor->archivo.is_open()) {
+            delete escritor;
+            return nullptr;
+        }
+        ConfigurarBuffer(escritor, tamanioBuffer, politica, lineasPorVaciado);
+        return escritor;
+    }
+
+    /*
+	 * Precondicion: @tamanioBuffer es mayor que cero y @cantidadBuffers es al menos 2
+	 * Postcondicion: Devuelve un Escritor del tipo archivo con buffer que no escribe en el hilo que lo usa: cada buffer
+	 * lleno pasa a un hilo de E/S propio del escritor y el llamador sigue llenando otro. Hay @cantidadBuffers buffers de
+	 * @tamanioBuffer bytes; si todos esperan ser escritos, el llamador espera a que se libere uno.
+	 * Vaciar espera a que todo lo escrito llegue al archivo y Destruir informa si alguna escritura fallo.
+	 * Si @nombreArchivo es un nombre de archivo invalido devuelve NULL
+	 */
+    Escritor* CrearEscritorArchivoAsincrono(string nombreArchivo, size_t tamanioBuffer, size_t cantidadBuffers) {
+        Escritor* escritor = CrearEscritorArchivo(std::move(nombreArchivo), tamanioBuffer, VACIAR_POR_TAMANIO);
+        if (escritor == nullptr) {
+            return nullptr;
+        }
+
+        cantidadBuffers = std::max<size_t>(cantidadBuffers, 2);
+        SalidaAsincrona* salida = new SalidaAsincrona;
+        salida->llenos.ranuras.resize(cantidadBuffers + 1);
+        salida->vacios.ranuras.resize(cantidadBuffers + 1);
+        // Uno de los buffers es el que ya tiene el escritor; los demas arrancan en la cola de vacios
+        for (size_t i = 1; i < cantidadBuffers; ++i) {
+            BloqueEscritura bloque;
+            bloque.datos.resize(escritor->tamanioBuffer);
+            PonerBloque(salida->vacios, bloque);
+        }
+        escritor->asincrona = salida;
+        salida->hilo = std::thread(EscribirBloquesPendientes, escritor);
+        return escritor;
+    }
+
+    /*
+	 * Precondicion: @tamanioBuffer y @enVuelo son mayores que cero
+	 * Postcondicion: Devuelve un Escritor del tipo ARCHIVO_IO_URING: lo escrito se copia a buffers alineados de
+	 * @tamanioBuffer bytes que se envian por io_uring, con hasta @enVuelo escrituras en curso y sin hilos propios, por lo
+	 * que se pueden escribir muchos archivos a la vez desde un solo hilo. Con @directo abre el archivo con O_DIRECT si el
+	 * sistema de archivos lo permite. Si io_uring no esta disponible escribe cada buffer con pwrite; donde no hay
+	 * pwrite devuelve un Escritor del tipo archivo con buffer. Si @nombreArchivo es un nombre de archivo invalido devuelve NULL
+	 */
+    Escritor* CrearEscritorArchivoIoUring(string nombreArchivo, size_t tamanioBuffer, unsigned int enVuelo, bool directo) {
+#ifdef _WIN32
+        (void)enVuelo;
+        (void)directo;
+        return CrearEscritorArchivo(std::move(nombreArchivo), tamanioBuffer, VACIAR_POR_TAMANIO);
+#else
+        URGEscrituraUring::EscrituraUring* uring =
+            URGEscrituraUring::AbrirEscrituraUring(nombreArchivo, tamanioBuffer, enVuelo, directo);
+        if (uring == nullptr) {
+            return nullptr;
+        }
+        Escritor* escritor = new Escritor;
+        escritor->tipo = ARCHIVO_IO_URING;
+        escritor->uring = uring;
+        return escritor;
+#endif
+    }
+
+    /*
+	 * Precondicion: @tamanioTrozo es mayor que cero
+	 * Postcondicion: Devuelve un Escritor del tipo MEMORIA, que guarda lo escrito en una lista de trozos de
+	 * @tamanioTrozo bytes en lugar de mandarlo a un archivo o a la consola. Un trozo lleno no se mueve ni se copia:
+	 * lo acumulado se lee con CantidadTrozos y ObtenerTrozo
+	 */
+    Escritor* CrearEscritorMemoria(size_t tamanioTrozo) {
+        Escritor* escritor = new Escritor;
+        escritor->tipo = MEMORIA;
+        escritor->tamanioTrozo = std::max<size_t>(tamanioTrozo, 1);
+        return escritor;
+    }
+
     /*
 	 * Precondicion: -
 	 * Postcondicion: Devuelve una instancia de Escritor del tipo consola.
@@ -39,31 +419,348 @@ namespace URGEscritor {
     }
 
     /*
-	 * Precondicion: @escritor fue creado con alguna de las primitivas: CrearEscritorArchivo o CrearEscritorConsola
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Devuelve una instancia de Escritor del tipo consola con buffer, que vacia segun @politica
+	 * (ver CrearEscritorArchivo con buffer).
+	 */
+    Escritor* CrearEscritorConsola(size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado) {
+        Escritor* escritor = CrearEscritorConsola();
+        ConfigurarBuffer(escritor, tamanioBuffer, politica, lineasPorVaciado);
+        return escritor;
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @texto apunta a @largo caracteres
+	 * Postcondicion: Escribe los @largo caracteres de @texto y agrega una nueva linea, igual que Escribir(Escritor*, const string&)
+	 */
+    void Escribir(Escritor* escritor, const char* texto, size_t largo) {
+        EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+        if (estadisticas != nullptr) {
+            ++estadisticas->escrituras;
+            estadisticas->bytesEscritos += largo + 1;
+        }
+        if (escritor->uring != nullptr) {
+            URGEscrituraUring::Escribir(escritor->uring, texto, largo);
+            URGEscrituraUring::Escribir(escritor->uring, "\n", 1);
+            return;
+        }
+        if (escritor->tamanioBuffer == 0) {
+            Reloj::time_point inicio = estadisticas != nullptr ? Reloj::now() : Reloj::time_point();
+            if (escritor->tipo == CONSOLA) {
+                std::cout.write(texto, static_cast<std::streamsize>(largo)) << std::endl;
+            }
+            else if (escritor->tipo == ARCHIVO) {
+                escritor->archivo.write(texto, static_cast<std::streamsize>(largo)) << std::endl;
+            }
+            else if (escritor->tipo == MEMORIA) {
+                AgregarEnMemoria(escritor, texto, largo);
+                AgregarEnMemoria(escritor, "\n", 1);
+            }
+            if (estadisticas != nullptr) {
+                RegistrarEscrituraDestino(estadisticas, NanosegundosDesde(inicio));
+            }
+            return;
+        }
+        Acumular(escritor, texto, largo);
+        Acumular(escritor, "\n", 1);
+        ContarLineas(escritor, 1);
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondicion: Si el @escritor es del tipo Consola escribe @texto en la salida estandard y agrega una nueva linea.
 	 * Si @escritor es del tipo archivo escribe @texto al final del archivo y agrega una nueva linea.
+	 * Un escritor sin buffer vacia en cada linea; uno con buffer vacia segun su politica
 	 * Parametros:
 	 * 		@escritor: Instancia de Escritor donde se desea escribir el @texto
 	 * 		@texto: Mensaje que se desea escribir.
 	 */
-    void Escribir(Escritor* escritor, string texto) {
+    void Escribir(Escritor* escritor, const string& texto) {
+        Escribir(escritor, texto.data(), texto.size());
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Igual que Escribir(Escritor*, const string&) sin copiar @texto
+	 */
+    void Escribir(Escritor* escritor, std::string_view texto) {
+        Escribir(escritor, texto.data(), texto.size());
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @texto termina en '\0'
+	 * Postcondicion: Igual que Escribir(Escritor*, const string&) sin copiar @texto
+	 */
+    void Escribir(Escritor* escritor, const char* texto) {
+        Escribir(escritor, texto, std::strlen(texto));
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @datos apunta a @largo caracteres
+	 * Postcondicion: Escribe los @largo caracteres de @datos tal cual, sin agregar una nueva linea ni forzar el vaciado.
+	 * Pensado para pasar de una vez bloques de muchas lineas ya armadas
+	 * Parametros:
+	 * 		@escritor: Instancia de Escritor donde se desea escribir el bloque
+	 * 		@datos: Caracteres a escribir
+	 * 		@largo: Cantidad de caracteres de @datos
+	 */
+    void EscribirBloque(Escritor* escritor, const char* datos, size_t largo) {
+        EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+        if (estadisticas != nullptr) {
+            ++estadisticas->escrituras;
+            estadisticas->bytesEscritos += largo;
+        }
+        if (escritor->uring != nullptr) {
+            URGEscrituraUring::Escribir(escritor->uring, datos, largo);
+            return;
+        }
+        if (escritor->tamanioBuffer == 0) {
+            EscribirDestino(escritor, datos, largo);
+            return;
+        }
+        Acumular(escritor, datos, largo);
+        if (escritor->politica == VACIAR_CADA_N_LINEAS) {
+            ContarLineas(escritor, static_cast<size_t>(std::count(datos, datos + largo, '\n')));
+        }
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Pasa al destino todo lo que @escritor tenga acumulado y vacia el flujo, sin importar la politica
+	 */
+    void Vaciar(Escritor* escritor) {
+        EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+        if (estadisticas != nullptr) {
+            ++estadisticas->vaciados;
+        }
+        if (escritor->uring != nullptr) {
+            URGEscrituraUring::Vaciar(escritor->uring);
+            return;
+        }
+        VaciarBuffer(escritor);
+        escritor->lineasPendientes = 0;
+        if (escritor->asincrona != nullptr) {
+            EsperarEscritos(escritor->asincrona);
+        }
         if (escritor->tipo == CONSOLA) {
-            std::cout << texto << std::endl;
+            std::cout.flush();
         }
         else if (escritor->tipo == ARCHIVO) {
-            escritor->archivo << texto << std::endl;
+            escritor->archivo.flush();
         }
     }
 
     /*
 	 * Precondiciones: @escritor es una instancia valida creada con alguna de las primitivas creacionales
-	 * Postcondiciones: Libera todos los recursos asociados a @escritor
+	 * Postcondiciones: Vacia lo pendiente (salvo con VACIAR_NUNCA) y libera todos los recursos asociados a @escritor.
+	 * En un escritor asincronico espera a que el hilo de E/S termine. Devuelve false si alguna escritura fallo o si,
+	 * con VACIAR_NUNCA, descarta datos que no se vaciaron
 	 */
-    void Destruir(Escritor* escritor) {
+    bool Destruir(Escritor* escritor) {
+        // Con VACIAR_NUNCA lo que no se vacio se pierde: se informa como una escritura fallida
+        bool exito = true;
+        if (escritor->tamanioBuffer > 0 && escritor->politica != VACIAR_NUNCA) {
+            Vaciar(escritor);
+        }
+        else if (escritor->usado > 0) {
+            exito = false;
+        }
+        if (escritor->uring != nullptr) {
+            exito = URGEscrituraUring::CerrarEscrituraUring(escritor->uring) && exito;
+        }
+        if (escritor->asincrona != nullptr) {
+            SalidaAsincrona* salida = escritor->asincrona;
+            Avisar(salida, [salida]() { salida->terminar.store(true, std::memory_order_release); });
+            escritor->asincrona->hilo.join();
+            exito = exito && !escritor->asincrona->error.load();
+            delete escritor->asincrona;
+        }
         if (escritor->tipo == ARCHIVO) {
             escritor->archivo.close();
+            exito = exito && !escritor->archivo.fail();
+        }
+        else if (escritor->tipo == CONSOLA) {
+            exito = exito && !std::cout.fail();
         }
+        delete escritor->estadisticas.load();
         delete escritor;
+        return exito;
+    }
+
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Devuelve true si @escritor es del tipo ARCHIVO_IO_URING y envia sus buffers por io_uring
+	 * (false si es de otro tipo o si usa pwrite)
+	 */
+    bool UsaIoUring(const Escritor* escritor) {
+        return escritor->uring != nullptr && URGEscrituraUring::UsaIoUring(escritor->uring);
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Si @escritor es del tipo ARCHIVO_IO_URING devuelve los bytes por segundo que llegaron al archivo
+	 * hasta la ultima escritura terminada. Para los demas tipos devuelve cero
+	 */
+    double ObtenerRendimiento(const Escritor* escritor) {
+        return escritor->uring != nullptr ? URGEscrituraUring::ObtenerRendimiento(escritor->uring) : 0;
+    }
+
+    /*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Devuelve la cantidad de trozos con datos que acumulo @escritor
+	 */
+    size_t CantidadTrozos(const Escritor* escritor) {
+        return escritor->trozos.size();
     }
 
+    /*
+	 * Precondicion: @escritor es del tipo MEMORIA e @indice es menor que CantidadTrozos(@escritor)
+	 * Postcondicion: Devuelve el trozo @indice de lo escrito, en orden, sin copiarlo. Los datos siguen siendo validos
+	 * hasta DescartarTrozos o Destruir; solo el ultimo trozo puede crecer con las escrituras siguientes
+	 */
+    TrozoMemoria ObtenerTrozo(const Escritor* escritor, size_t indice) {
+        const std::vector<char>& trozo = escritor->trozos[indice];
+        return TrozoMemoria{ trozo.data(), trozo.size() };
+    }
+
+    /*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Devuelve la cantidad de bytes que acumulo @escritor (la suma de los largos de sus trozos)
+	 */
+    size_t ObtenerTamanioMemoria(const Escritor* escritor) {
+        size_t tamanio = 0;
+        for (const std::vector<char>& trozo : escritor->trozos) {
+            tamanio += trozo.size();
+        }
+        return tamanio;
+    }
+
+    /*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Libera los trozos acumulados por @escritor (por ejemplo, despues de enviarlos). Lo que se escriba
+	 * despues empieza en un trozo nuevo
+	 */
+    void DescartarTrozos(Escritor* escritor) {
+        escritor->trozos.clear();
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: @escritor empieza a medir lo que escribe (ver EstadisticasEscritor). Sin esta llamada no mide nada
+	 * y no paga el costo de tomar el tiempo en cada escritura al destino. En un escritor asincronico espera antes a que
+	 * el hilo de E/S escriba lo que ya recibio, asi ese hilo no mide ninguna escritura a medias
+	 */
+    void ActivarEstadisticas(Escritor* escritor) {
+        if (escritor->estadisticas.load(std::memory_order_relaxed) != nullptr) {
+            return;
+        }
+        if (escritor->asincrona != nullptr) {
+            EsperarEscritos(escritor->asincrona);
+        }
+        EstadisticasEscritor* estadisticas = new EstadisticasEscritor;
+        escritor->estadisticas.store(estadisticas, std::memory_order_release);
+        if (escritor->uring != nullptr) {
+            URGEscrituraUring::AvisarEscrituras(escritor->uring, RegistrarEscrituraUring, estadisticas);
+        }
+    }
+
+    /*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales. Si es
+	 * asincronico, no se escribio nada desde el ultimo Vaciar
+	 * Postcondicion: Devuelve lo medido por @escritor desde ActivarEstadisticas (todo en cero si no se activaron)
+	 */
+    EstadisticasEscritor ObtenerEstadisticas(const Escritor* escritor) {
+        EstadisticasEscritor* estadisticas = escritor->estadisticas.load(std::memory_order_acquire);
+        return estadisticas != nullptr ? *estadisticas : EstadisticasEscritor();
+    }
+
+    /*
+	 * Precondicion: @percentil esta entre 0 y 100
+	 * Postcondicion: Devuelve la latencia en nanosegundos por debajo de la cual quedo el @percentil de las escrituras
+	 * al destino de @estadisticas, con el error relativo de su cubeta (cero si no hubo escrituras)
+	 */
+    unsigned long long ObtenerPercentilLatencia(const EstadisticasEscritor& estadisticas, double percentil) {
+        if (estadisticas.escriturasDestino == 0) {
+            return 0;
+        }
+        double objetivo = std::max(1.0, std::ceil(static_cast<double>(estadisticas.escriturasDestino) * percentil / 100));
+        unsigned long long acumuladas = 0;
+        for (size_t i = 0; i < CANTIDAD_CUBETAS_LATENCIA; ++i) {
+            acumuladas += estadisticas.cubetas[i];
+            if (static_cast<double>(acumuladas) >= objetivo) {
+                return std::min(LimiteCubeta(i), estadisticas.latenciaMaxima);
+            }
+        }
+        return estadisticas.latenciaMaxima;
+    }
+
+    /*
+	 * Precondicion: -
+	 * Postcondicion: Devuelve @estadisticas como un objeto JSON con los contadores, un resumen de la latencia
+	 * (minima, media, maxima y percentiles 50, 90, 99 y 99.9) y las cubetas no vacias del histograma
+	 */
+    string EstadisticasAJSON(const EstadisticasEscritor& estadisticas) {
+        unsigned long long media = estadisticas.escriturasDestino > 0 ? estadisticas.nanosegundosDestino / estadisticas.escriturasDestino : 0;
+        string json = "{\"bytesEscritos\":" + std::to_string(estadisticas.bytesEscritos) +
+            ",\"escrituras\":" + std::to_string(estadisticas.escrituras) +
+            ",\"escriturasDestino\":" + std::to_string(estadisticas.escriturasDestino) +
+            ",\"vaciados\":" + std::to_string(estadisticas.vaciados) +
+            ",\"nanosegundosDestino\":" + std::to_string(estadisticas.nanosegundosDestino) +
+            ",\"latenciaNanosegundos\":{\"minima\":" + std::to_string(estadisticas.latenciaMinima) +
+            ",\"media\":" + std::to_string(media) +
+            ",\"maxima\":" + std::to_string(estadisticas.latenciaMaxima) +
+            ",\"p50\":" + std::to_string(ObtenerPercentilLatencia(estadisticas, 50)) +
+            ",\"p90\":" + std::to_string(ObtenerPercentilLatencia(estadisticas, 90)) +
+            ",\"p99\":" + std::to_string(ObtenerPercentilLatencia(estadisticas, 99)) +
+            ",\"p999\":" + std::to_string(ObtenerPercentilLatencia(estadisticas, 99.9)) +
+            "},\"histograma\":[";
+        bool primera = true;
+        for (size_t i = 0; i < CANTIDAD_CUBETAS_LATENCIA; ++i) {
+            if (estadisticas.cubetas[i] == 0) {
+                continue;
+            }
+            json += primera ? "" : ",";
+            json += "{\"hasta\":" + std::to_string(LimiteCubeta(i)) + ",\"cantidad\":" + std::to_string(estadisticas.cubetas[i]) + "}";
+            primera = false;
+        }
+        return json + "]}";
+    }
+
+    /*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearEscritorArchivo(string) pero el escritor queda a cargo del EscritorUnico devuelto
+	 * (vacio si @nombreArchivo es invalido)
+	 */
+    EscritorUnico CrearEscritorArchivoUnico(string nombreArchivo) {
+        return EscritorUnico(CrearEscritorArchivo(std::move(nombreArchivo)));
+    }
+
+    /*
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorArchivo con buffer pero el escritor queda a cargo del EscritorUnico devuelto
+	 * (vacio si @nombreArchivo es invalido)
+	 */
+    EscritorUnico CrearEscritorArchivoUnico(string nombreArchivo, size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado) {
+        return EscritorUnico(CrearEscritorArchivo(std::move(nombreArchivo), tamanioBuffer, politica, lineasPorVaciado));
+    }
+
+    /*
+	 * Precondicion: @tamanioTrozo es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorMemoria pero el escritor queda a cargo del EscritorUnico devuelto
+	 */
+    EscritorUnico CrearEscritorMemoriaUnico(size_t tamanioTrozo) {
+        return EscritorUnico(CrearEscritorMemoria(tamanioTrozo));
+    }
+
+    /*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearEscritorConsola pero el escritor queda a cargo del EscritorUnico devuelto
+	 */
+    EscritorUnico CrearEscritorConsolaUnico() {
+        return EscritorUnico(CrearEscritorConsola());
+    }
 }
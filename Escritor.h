@@ -1,15 +1,57 @@
 #ifndef ESCRITOR_H_
 #define ESCRITOR_H_
 
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <string_view>
 using std::string;
 
 namespace URGEscritor{
-	enum TipoEscritor { ARCHIVO, CONSOLA };
+	enum TipoEscritor { ARCHIVO, CONSOLA, ARCHIVO_IO_URING, MEMORIA };
+
+	/*
+	 * Cuando pasa al destino lo acumulado por un escritor con buffer:
+	 * - VACIAR_NUNCA: solo con Vaciar. El buffer crece lo necesario y Destruir descarta lo que no se vacio (y devuelve false)
+	 * - VACIAR_POR_TAMANIO: cada vez que se llena el buffer, y al destruir
+	 * - VACIAR_AL_DESTRUIR: una sola vez al destruir (o con Vaciar). El buffer crece lo necesario
+	 * - VACIAR_CADA_N_LINEAS: cada N lineas escritas, cuando se llena el buffer y al destruir
+	 */
+	enum PoliticaVaciado { VACIAR_NUNCA, VACIAR_POR_TAMANIO, VACIAR_AL_DESTRUIR, VACIAR_CADA_N_LINEAS };
+
 	struct Escritor;
 
+	/*
+	 * Cubetas del histograma de latencias, al estilo HDR: los valores menores a 16 nanosegundos tienen una cubeta cada
+	 * uno y cada potencia de dos a partir de ahi se divide en 16 cubetas, asi que el error relativo es menor al 6.25%
+	 * para cualquier latencia
+	 */
+	const size_t CANTIDAD_CUBETAS_LATENCIA = 16 + 60 * 16;
+
+	/*
+	 * Lo medido por un Escritor con estadisticas activas. Una escritura al destino es cada vez que el escritor pasa
+	 * datos al archivo, la consola o la memoria: en archivos y consola es una llamada al sistema (salvo en los
+	 * escritores sin buffer, donde la hace el flujo al vaciar cada linea)
+	 */
+	struct EstadisticasEscritor {
+		unsigned long long bytesEscritos = 0; // Bytes recibidos por Escribir y EscribirBloque, con los fin de linea
+		unsigned long long escrituras = 0; // Llamadas a Escribir y EscribirBloque
+		unsigned long long escriturasDestino = 0;
+		unsigned long long vaciados = 0; // Llamadas a Vaciar, explicitas o por la politica del escritor
+		unsigned long long nanosegundosDestino = 0; // Tiempo total de las escrituras al destino
+		unsigned long long latenciaMinima = 0;
+		unsigned long long latenciaMaxima = 0;
+		unsigned long long cubetas[CANTIDAD_CUBETAS_LATENCIA] = {}; // Latencias de las escrituras al destino
+	};
+
+	// Porcion contigua de lo escrito por un Escritor del tipo MEMORIA
+	struct TrozoMemoria {
+		const char* datos;
+		size_t largo;
+	};
+
 	/*
 	 * Precondicion: -
 	 * Postcondicion: Si @nombreArchivo es un nombre de archivo invalido devuelve NULL.
@@ -21,6 +63,47 @@ namespace URGEscritor{
 	 */
 	Escritor* CrearEscritorArchivo(string nombreArchivo);
 
+	/*
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorArchivo(string) pero el escritor acumula lo escrito en un buffer propio de
+	 * @tamanioBuffer bytes y lo pasa al archivo con una sola escritura segun @politica, en lugar de vaciar en cada linea.
+	 * Parametros:
+	 * 		@nombreArchivo: ruta y nombre del archivo donde se desea escribir
+	 * 		@tamanioBuffer: bytes que se acumulan antes de escribir en el archivo
+	 * 		@politica: cuando se vacia el buffer (ver PoliticaVaciado)
+	 * 		@lineasPorVaciado: cada cuantas lineas se vacia con VACIAR_CADA_N_LINEAS
+	 * 		@return: Instancia de Escritor lista para ser utilizada por las primitivas del TDA Escritor
+	 */
+	Escritor* CrearEscritorArchivo(string nombreArchivo, size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado = 0);
+
+	/*
+	 * Precondicion: @tamanioBuffer es mayor que cero y @cantidadBuffers es al menos 2
+	 * Postcondicion: Devuelve un Escritor del tipo archivo con buffer que no escribe en el hilo que lo usa: cada buffer
+	 * lleno pasa a un hilo de E/S propio del escritor y el llamador sigue llenando otro. Hay @cantidadBuffers buffers de
+	 * @tamanioBuffer bytes; si todos esperan ser escritos, el llamador espera a que se libere uno.
+	 * Vaciar espera a que todo lo escrito llegue al archivo y Destruir informa si alguna escritura fallo.
+	 * Si @nombreArchivo es un nombre de archivo invalido devuelve NULL
+	 */
+	Escritor* CrearEscritorArchivoAsincrono(string nombreArchivo, size_t tamanioBuffer = 1 << 20, size_t cantidadBuffers = 2);
+
+	/*
+	 * Precondicion: @tamanioBuffer y @enVuelo son mayores que cero
+	 * Postcondicion: Devuelve un Escritor del tipo ARCHIVO_IO_URING: lo escrito se copia a buffers alineados de
+	 * @tamanioBuffer bytes que se envian por io_uring, con hasta @enVuelo escrituras en curso y sin hilos propios, por lo
+	 * que se pueden escribir muchos archivos a la vez desde un solo hilo. Con @directo abre el archivo con O_DIRECT si el
+	 * sistema de archivos lo permite. Si io_uring no esta disponible escribe cada buffer con pwrite; donde no hay
+	 * pwrite devuelve un Escritor del tipo archivo con buffer. Si @nombreArchivo es un nombre de archivo invalido devuelve NULL
+	 */
+	Escritor* CrearEscritorArchivoIoUring(string nombreArchivo, size_t tamanioBuffer = 1 << 20, unsigned int enVuelo = 4, bool directo = false);
+
+	/*
+	 * Precondicion: @tamanioTrozo es mayor que cero
+	 * Postcondicion: Devuelve un Escritor del tipo MEMORIA, que guarda lo escrito en una lista de trozos de
+	 * @tamanioTrozo bytes en lugar de mandarlo a un archivo o a la consola. Un trozo lleno no se mueve ni se copia:
+	 * lo acumulado se lee con CantidadTrozos y ObtenerTrozo
+	 */
+	Escritor* CrearEscritorMemoria(size_t tamanioTrozo = 1 << 16);
+
 	/*
 	 * Precondicion: -
 	 * Postcondicion: Devuelve una instancia de Escritor del tipo consola.
@@ -30,20 +113,174 @@ namespace URGEscritor{
 	Escritor* CrearEscritorConsola();
 
 	/*
-	 * Precondicion: @escritor fue creado con alguna de las primitivas: CrearEscritorArchivo o CrearEscritorConsola
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Devuelve una instancia de Escritor del tipo consola con buffer, que vacia segun @politica
+	 * (ver CrearEscritorArchivo con buffer).
+	 */
+	Escritor* CrearEscritorConsola(size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado = 0);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondicion: Si el @escritor es del tipo Consola escribe @texto en la salida estandard y agrega una nueva linea.
 	 * Si @escritor es del tipo archivo escribe @texto al final del archivo y agrega una nueva linea.
+	 * Un escritor sin buffer vacia en cada linea; uno con buffer vacia segun su politica
 	 * Parametros:
 	 * 		@escritor: Instancia de Escritor donde se desea escribir el @texto
 	 * 		@texto: Mensaje que se desea escribir.
 	 */
-	void Escribir(Escritor* escritor, string texto);
+	void Escribir(Escritor* escritor, const string& texto);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Igual que Escribir(Escritor*, const string&) sin copiar @texto
+	 */
+	void Escribir(Escritor* escritor, std::string_view texto);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @texto termina en '\0'
+	 * Postcondicion: Igual que Escribir(Escritor*, const string&) sin copiar @texto
+	 */
+	void Escribir(Escritor* escritor, const char* texto);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @texto apunta a @largo caracteres
+	 * Postcondicion: Escribe los @largo caracteres de @texto y agrega una nueva linea, igual que Escribir(Escritor*, const string&)
+	 */
+	void Escribir(Escritor* escritor, const char* texto, size_t largo);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @datos apunta a @largo caracteres
+	 * Postcondicion: Escribe los @largo caracteres de @datos tal cual, sin agregar una nueva linea ni forzar el vaciado.
+	 * Pensado para pasar de una vez bloques de muchas lineas ya armadas
+	 * Parametros:
+	 * 		@escritor: Instancia de Escritor donde se desea escribir el bloque
+	 * 		@datos: Caracteres a escribir
+	 * 		@largo: Cantidad de caracteres de @datos
+	 */
+	void EscribirBloque(Escritor* escritor, const char* datos, size_t largo);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Pasa al destino todo lo que @escritor tenga acumulado y vacia el flujo, sin importar la politica
+	 */
+	void Vaciar(Escritor* escritor);
 
 	/*
 	 * Precondiciones: @escritor es una instancia valida creada con alguna de las primitivas creacionales
-	 * Postcondiciones: Libera todos los recursos asociados a @escritor
+	 * Postcondiciones: Vacia lo pendiente (salvo con VACIAR_NUNCA) y libera todos los recursos asociados a @escritor.
+	 * En un escritor asincronico espera a que el hilo de E/S termine. Devuelve false si alguna escritura fallo o si,
+	 * con VACIAR_NUNCA, descarta datos que no se vaciaron
+	 */
+	bool Destruir(Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Devuelve true si @escritor es del tipo ARCHIVO_IO_URING y envia sus buffers por io_uring
+	 * (false si es de otro tipo o si usa pwrite)
+	 */
+	bool UsaIoUring(const Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Si @escritor es del tipo ARCHIVO_IO_URING devuelve los bytes por segundo que llegaron al archivo
+	 * hasta la ultima escritura terminada. Para los demas tipos devuelve cero
+	 */
+	double ObtenerRendimiento(const Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Devuelve la cantidad de trozos con datos que acumulo @escritor
+	 */
+	size_t CantidadTrozos(const Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es del tipo MEMORIA e @indice es menor que CantidadTrozos(@escritor)
+	 * Postcondicion: Devuelve el trozo @indice de lo escrito, en orden, sin copiarlo. Los datos siguen siendo validos
+	 * hasta DescartarTrozos o Destruir; solo el ultimo trozo puede crecer con las escrituras siguientes
+	 */
+	TrozoMemoria ObtenerTrozo(const Escritor* escritor, size_t indice);
+
+	/*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Devuelve la cantidad de bytes que acumulo @escritor (la suma de los largos de sus trozos)
+	 */
+	size_t ObtenerTamanioMemoria(const Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es del tipo MEMORIA
+	 * Postcondicion: Libera los trozos acumulados por @escritor (por ejemplo, despues de enviarlos). Lo que se escriba
+	 * despues empieza en un trozo nuevo
+	 */
+	void DescartarTrozos(Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: @escritor empieza a medir lo que escribe (ver EstadisticasEscritor). Sin esta llamada no mide nada
+	 * y no paga el costo de tomar el tiempo en cada escritura al destino. En un escritor asincronico espera antes a que
+	 * el hilo de E/S escriba lo que ya recibio, asi ese hilo no mide ninguna escritura a medias
+	 */
+	void ActivarEstadisticas(Escritor* escritor);
+
+	/*
+	 * Precondicion: @escritor es una instancia valida creada con alguna de las primitivas creacionales. Si es
+	 * asincronico, no se escribio nada desde el ultimo Vaciar
+	 * Postcondicion: Devuelve lo medido por @escritor desde ActivarEstadisticas (todo en cero si no se activaron)
+	 */
+	EstadisticasEscritor ObtenerEstadisticas(const Escritor* escritor);
+
+	/*
+	 * Precondicion: @percentil esta entre 0 y 100
+	 * Postcondicion: Devuelve la latencia en nanosegundos por debajo de la cual quedo el @percentil de las escrituras
+	 * al destino de @estadisticas, con el error relativo de su cubeta (cero si no hubo escrituras)
+	 */
+	unsigned long long ObtenerPercentilLatencia(const EstadisticasEscritor& estadisticas, double percentil);
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Devuelve @estadisticas como un objeto JSON con los contadores, un resumen de la latencia
+	 * (minima, media, maxima y percentiles 50, 90, 99 y 99.9) y las cubetas no vacias del histograma
+	 */
+	string EstadisticasAJSON(const EstadisticasEscritor& estadisticas);
+
+	/*
+	 * Destructor para std::unique_ptr: llama a Destruir. Como descarta su resultado, quien necesite saber si alguna
+	 * escritura fallo tiene que llamar a Destruir(escritor.release())
+	 */
+	struct DestructorEscritor {
+		void operator()(Escritor* escritor) const { Destruir(escritor); }
+	};
+
+	// Escritor que se destruye solo al salir de alcance. get() da el puntero que reciben las demas primitivas
+	typedef std::unique_ptr<Escritor, DestructorEscritor> EscritorUnico;
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearEscritorArchivo(string) pero el escritor queda a cargo del EscritorUnico devuelto
+	 * (vacio si @nombreArchivo es invalido)
+	 */
+	EscritorUnico CrearEscritorArchivoUnico(string nombreArchivo);
+
+	/*
+	 * Precondicion: @tamanioBuffer es mayor que cero. Si @politica es VACIAR_CADA_N_LINEAS, @lineasPorVaciado es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorArchivo con buffer pero el escritor queda a cargo del EscritorUnico devuelto
+	 * (vacio si @nombreArchivo es invalido)
+	 */
+	EscritorUnico CrearEscritorArchivoUnico(string nombreArchivo, size_t tamanioBuffer, PoliticaVaciado politica, size_t lineasPorVaciado = 0);
+
+	/*
+	 * Precondicion: @tamanioTrozo es mayor que cero
+	 * Postcondicion: Igual que CrearEscritorMemoria pero el escritor queda a cargo del EscritorUnico devuelto
+	 */
+	EscritorUnico CrearEscritorMemoriaUnico(size_t tamanioTrozo = 1 << 16);
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearEscritorConsola pero el escritor queda a cargo del EscritorUnico devuelto
 	 */
-	void Destruir(Escritor* escritor);
+	EscritorUnico CrearEscritorConsolaUnico();
 }
 
 #endif
@@ -0,0 +1,492 @@
+#include "EscrituraUring.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+#ifndef _WIN32
+#include <cerrno>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define URG_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace URGEscrituraUring {
+	typedef std::chrono::steady_clock Reloj;
+
+#ifdef URG_IO_URING
+	// Colas compartidas con el kernel, mapeadas a partir del descriptor que devuelve io_uring_setup (sin liburing)
+	struct Anillo {
+		int descriptor = -1;
+		void* envio = nullptr;
+		size_t tamanioEnvio = 0;
+		void* terminadas = nullptr;
+		size_t tamanioTerminadas = 0;
+		io_uring_sqe* entradas = nullptr;
+		size_t tamanioEntradas = 0;
+		unsigned* colaEnvio = nullptr;
+		unsigned* mascaraEnvio = nullptr;
+		unsigned* indicesEnvio = nullptr;
+		unsigned* cabezaTerminadas = nullptr;
+		unsigned* colaTerminadas = nullptr;
+		unsigned* mascaraTerminadas = nullptr;
+		io_uring_cqe* resultados = nullptr;
+	};
+#endif
+
+	struct EscrituraUring {
+		int descriptor = -1;
+		// Sin O_DIRECT, para lo que no esta alineado. Es el mismo que descriptor si no se pidio O_DIRECT
+		int descriptorComun = -1;
+		bool directo = false;
+		size_t tamanioBuffer = 0;
+		std::vector<char*> buffers;
+		std::vector<size_t> libres;
+		// Largo y offset de la escritura en vuelo de cada buffer
+		std::vector<size_t> largos;
+		std::vector<unsigned long long> offsets;
+		std::vector<Reloj::time_point> envios;
+		std::vector<bool> enVuelo;
+		size_t actual = 0;
+		size_t usado = 0;
+		unsigned long long offset = 0; // Posicion en el archivo del primer byte del buffer actual
+		unsigned int pendientes = 0;
+		bool error = false;
+		unsigned long long bytesEscritos = 0;
+		size_t colaEscrita = 0; // Bytes de la cola que llegaron al archivo en el ultimo EscribirCola (solo con O_DIRECT)
+		Reloj::time_point inicio;
+		Reloj::time_point ultimaEscritura;
+		FuncionEscrituraTerminada aviso = nullptr;
+		void* contextoAviso = nullptr;
+#ifdef URG_IO_URING
+		Anillo anillo;
+		bool conAnillo = false;
+#endif
+	};
+
+#ifndef _WIN32
+	// Devuelve cuantos de los @largo bytes llegaron al archivo: menos que @largo si alguna escritura fallo
+	static size_t EscribirTodo(int descriptor, const char* datos, size_t largo, unsigned long long offset) {
+		size_t total = 0;
+		while (total < largo) {
+			ssize_t escritos = pwrite(descriptor, datos + total, largo - total, static_cast<off_t>(offset + total));
+			if (escritos < 0 && errno == EINTR) {
+				continue;
+			}
+			if (escritos <= 0) {
+				break;
+			}
+			total += static_cast<size_t>(escritos);
+		}
+		return total;
+	}
+
+	/*
+	 * Registra el resultado de la escritura del buffer @indice y lo devuelve a la lista de libres. Solo cuenta los bytes
+	 * que llegaron al archivo, y solo avisa la latencia de las escrituras que terminaron completas
+	 */
+	static void Completar(EscrituraUring* escritura, size_t indice, long long resultado) {
+		size_t largo = escritura->largos[indice];
+		size_t escritos = 0;
+		if (resultado >= 0) {
+			escritos = std::min(static_cast<size_t>(resultado), largo);
+			if (escritos < largo) {
+				// Escritura corta: el resto ya no esta alineado y va por el descriptor comun
+				escritos += EscribirTodo(escritura->descriptorComun, escritura->buffers[indice] + escritos, largo - escritos,
+					escritura->offsets[indice] + escritos);
+			}
+		}
+		if (escritos > 0) {
+			escritura->bytesEscritos += escritos;
+			escritura->ultimaEscritura = Reloj::now();
+		}
+		if (escritos < largo) {
+			escritura->error = true;
+		}
+		else if (escritura->aviso != nullptr) {
+			std::chrono::nanoseconds demora = escritura->ultimaEscritura - escritura->envios[indice];
+			escritura->aviso(largo, static_cast<unsigned long long>(demora.count()), escritura->contextoAviso);
+		}
+		escritura->enVuelo[indice] = false;
+		escritura->libres.push_back(indice);
+		--escritura->pendientes;
+	}
+
+#ifdef URG_IO_URING
+	static int EntrarAnillo(Anillo& anillo, unsigned int enviar, unsigned int esperar, unsigned int banderas) {
+		long resultado;
+		do {
+			resultado = syscall(__NR_io_uring_enter, anillo.descriptor, enviar, esperar, banderas, nullptr, 0);
+		} while (resultado < 0 && errno == EINTR);
+		return static_cast<int>(resultado);
+	}
+
+	static bool IniciarAnillo(Anillo& anillo, unsigned int entradas) {
+		io_uring_params parametros;
+		std::memset(&parametros, 0, sizeof(parametros));
+		long descriptor = syscall(__NR_io_uring_setup, entradas, &parametros);
+		if (descriptor < 0) {
+			return false;
+		}
+		anillo.descriptor = static_cast<int>(descriptor);
+
+		anillo.tamanioEnvio = parametros.sq_off.array + parametros.sq_entries * sizeof(unsigned);
+		anillo.tamanioTerminadas = parametros.cq_off.cqes + parametros.cq_entries * sizeof(io_uring_cqe);
+		bool unSoloMapeo = (parametros.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (unSoloMapeo) {
+			anillo.tamanioEnvio = anillo.tamanioTerminadas = std::max(anillo.tamanioEnvio, anillo.tamanioTerminadas);
+		}
+		anillo.envio = mmap(nullptr, anillo.tamanioEnvio, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			anillo.descriptor, IORING_OFF_SQ_RING);
+		if (anillo.envio == MAP_FAILED) {
+			anillo.envio = nullptr;
+			return false;
+		}
+		anillo.terminadas = unSoloMapeo ? anillo.envio : mmap(nullptr, anillo.tamanioTerminadas, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, anillo.descriptor, IORING_OFF_CQ_RING);
+		if (anillo.terminadas == MAP_FAILED) {
+			anillo.terminadas = nullptr;
+			return false;
+		}
+		anillo.tamanioEntradas = parametros.sq_entries * sizeof(io_uring_sqe);
+		void* entradasMapeadas = mmap(nullptr, anillo.tamanioEntradas, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			anillo.descriptor, IORING_OFF_SQES);
+		if (entradasMapeadas == MAP_FAILED) {
+			return false;
+		}
+		anillo.entradas = static_cast<io_uring_sqe*>(entradasMapeadas);
+
+		char* envio = static_cast<char*>(anillo.envio);
+		anillo.colaEnvio = reinterpret_cast<unsigned*>(envio + parametros.sq_off.tail);
+		anillo.mascaraEnvio = reinterpret_cast<unsigned*>(envio + parametros.sq_off.ring_mask);
+		anillo.indicesEnvio = reinterpret_cast<unsigned*>(envio + parametros.sq_off.array);
+		char* terminadas = static_cast<char*>(anillo.terminadas);
+		anillo.cabezaTerminadas = reinterpret_cast<unsigned*>(terminadas + parametros.cq_off.head);
+		anillo.colaTerminadas = reinterpret_cast<unsigned*>(terminadas + parametros.cq_off.tail);
+		anillo.mascaraTerminadas = reinterpret_cast<unsigned*>(terminadas + parametros.cq_off.ring_mask);
+		anillo.resultados = reinterpret_cast<io_uring_cqe*>(terminadas + parametros.cq_off.cqes);
+		return true;
+	}
+
+	static void LiberarAnillo(Anillo& anillo) {
+		if (anillo.entradas != nullptr) {
+			munmap(anillo.entradas, anillo.tamanioEntradas);
+		}
+		if (anillo.terminadas != nullptr && anillo.terminadas != anillo.envio) {
+			munmap(anillo.terminadas, anillo.tamanioTerminadas);
+		}
+		if (anillo.envio != nullptr) {
+			munmap(anillo.envio, anillo.tamanioEnvio);
+		}
+		if (anillo.descriptor >= 0) {
+			close(anillo.descriptor);
+		}
+		anillo = Anillo();
+	}
+
+	// Procesa las escrituras que el kernel ya termino, sin esperar
+	static void RecogerTerminadas(EscrituraUring* escritura) {
+		Anillo& anillo = escritura->anillo;
+		unsigned cabeza = *anillo.cabezaTerminadas;
+		unsigned cola = __atomic_load_n(anillo.colaTerminadas, __ATOMIC_ACQUIRE);
+		for (; cabeza != cola; ++cabeza) {
+			const io_uring_cqe& resultado = anillo.resultados[cabeza & *anillo.mascaraTerminadas];
+			Completar(escritura, static_cast<size_t>(resultado.user_data), resultado.res);
+		}
+		__atomic_store_n(anillo.cabezaTerminadas, cabeza, __ATOMIC_RELEASE);
+	}
+
+	/*
+	 * Esperar en el anillo fallo con un error que no es transitorio: se deja de usar el anillo para no esperar para
+	 * siempre. Las escrituras que siguen en vuelo se dan por fallidas y sus buffers vuelven a la lista de libres, y lo
+	 * que se escriba despues va con pwrite
+	 */
+	static void AbandonarAnillo(EscrituraUring* escritura) {
+		RecogerTerminadas(escritura);
+		escritura->conAnillo = false;
+		for (size_t indice = 0; indice < escritura->enVuelo.size(); ++indice) {
+			if (escritura->enVuelo[indice]) {
+				Completar(escritura, indice, -1);
+			}
+		}
+	}
+
+	// Espera en el anillo al menos una escritura. Solo EINTR (que reintenta EntrarAnillo) y EAGAIN son transitorios
+	static void EsperarEnAnillo(EscrituraUring* escritura) {
+		if (EntrarAnillo(escritura->anillo, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EAGAIN) {
+			AbandonarAnillo(escritura);
+		}
+	}
+#endif
+
+	static void EnviarBuffer(EscrituraUring* escritura, size_t indice, size_t largo, unsigned long long offset) {
+		escritura->largos[indice] = largo;
+		escritura->offsets[indice] = offset;
+		escritura->envios[indice] = Reloj::now();
+		escritura->enVuelo[indice] = true;
+		++escritura->pendientes;
+#ifdef URG_IO_URING
+		if (escritura->conAnillo) {
+			Anillo& anillo = escritura->anillo;
+			unsigned cola = *anillo.colaEnvio;
+			unsigned posicion = cola & *anillo.mascaraEnvio;
+			io_uring_sqe& entrada = anillo.entradas[posicion];
+			std::memset(&entrada, 0, sizeof(entrada));
+			entrada.opcode = IORING_OP_WRITE;
+			entrada.fd = escritura->descriptor;
+			entrada.addr = reinterpret_cast<unsigned long long>(escritura->buffers[indice]);
+			entrada.len = static_cast<unsigned>(largo);
+			entrada.off = offset;
+			entrada.user_data = indice;
+			anillo.indicesEnvio[posicion] = posicion;
+			__atomic_store_n(anillo.colaEnvio, cola + 1, __ATOMIC_RELEASE);
+			if (EntrarAnillo(anillo, 1, 0, 0) == 1) {
+				return;
+			}
+			// El kernel no tomo la entrada (error o cero enviadas): se retira y el buffer se escribe con pwrite
+			__atomic_store_n(anillo.colaEnvio, cola, __ATOMIC_RELEASE);
+		}
+#endif
+		// Si pwrite falla a mitad de camino, Completar reintenta el resto por el descriptor comun
+		Completar(escritura, indice, static_cast<long long>(EscribirTodo(escritura->descriptor, escritura->buffers[indice], largo, offset)));
+	}
+
+	// Espera a que termine al menos una escritura en vuelo
+	static void EsperarUna(EscrituraUring* escritura) {
+#ifdef URG_IO_URING
+		if (escritura->conAnillo && escritura->pendientes > 0) {
+			RecogerTerminadas(escritura);
+			if (escritura->libres.empty()) {
+				EsperarEnAnillo(escritura);
+			}
+			if (escritura->conAnillo) {
+				RecogerTerminadas(escritura);
+			}
+		}
+#else
+		(void)escritura;
+#endif
+	}
+
+	static size_t TomarBufferLibre(EscrituraUring* escritura) {
+		while (escritura->libres.empty()) {
+			EsperarUna(escritura);
+		}
+		size_t indice = escritura->libres.back();
+		escritura->libres.pop_back();
+		return indice;
+	}
+
+	static void EsperarTodas(EscrituraUring* escritura) {
+#ifdef URG_IO_URING
+		while (escritura->conAnillo && escritura->pendientes > 0) {
+			EsperarEnAnillo(escritura);
+			if (escritura->conAnillo) {
+				RecogerTerminadas(escritura);
+			}
+		}
+#else
+		(void)escritura;
+#endif
+	}
+
+	// Escribe la parte del buffer actual que no completa un bloque alineado
+	static void EscribirCola(EscrituraUring* escritura) {
+		escritura->colaEscrita = escritura->usado > 0 ? EscribirTodo(escritura->descriptorComun,
+			escritura->buffers[escritura->actual], escritura->usado, escritura->offset) : 0;
+		if (escritura->colaEscrita < escritura->usado) {
+			escritura->error = true;
+		}
+	}
+#endif
+
+	/*
+	 * Precondicion: @tamanioBuffer y @enVuelo son mayores que cero
+	 * Postcondicion: Crea (o trunca) @nombreArchivo y devuelve una instancia de EscrituraUring con @enVuelo buffers de
+	 * @tamanioBuffer bytes (redondeado a ALINEACION). Con @directo usa O_DIRECT si el sistema de archivos lo permite.
+	 * Si no se puede abrir el archivo devuelve NULL (siempre en plataformas sin pwrite)
+	 */
+	EscrituraUring* AbrirEscrituraUring(const string& nombreArchivo, size_t tamanioBuffer, unsigned int enVuelo, bool directo) {
+#ifdef _WIN32
+		(void)nombreArchivo;
+		(void)tamanioBuffer;
+		(void)enVuelo;
+		(void)directo;
+		return nullptr;
+#else
+		int banderas = O_WRONLY | O_CREAT | O_TRUNC;
+		int descriptorComun = open(nombreArchivo.c_str(), banderas, 0644);
+		if (descriptorComun < 0) {
+			return nullptr;
+		}
+
+		EscrituraUring* escritura = new EscrituraUring;
+		escritura->descriptor = escritura->descriptorComun = descriptorComun;
+#ifdef O_DIRECT
+		if (directo) {
+			// Algunos sistemas de archivos (tmpfs, por ejemplo) no aceptan O_DIRECT: se sigue sin el
+			int descriptorDirecto = open(nombreArchivo.c_str(), O_WRONLY | O_DIRECT);
+			if (descriptorDirecto >= 0) {
+				escritura->descriptor = descriptorDirecto;
+				escritura->directo = true;
+			}
+		}
+#else
+		(void)directo;
+#endif
+
+		enVuelo = std::max(enVuelo, 1u);
+		escritura->tamanioBuffer = (std::max<size_t>(tamanioBuffer, 1) + ALINEACION - 1) / ALINEACION * ALINEACION;
+		escritura->largos.resize(enVuelo);
+		escritura->offsets.resize(enVuelo);
+		escritura->envios.resize(enVuelo);
+		escritura->enVuelo.resize(enVuelo);
+		for (unsigned int i = 0; i < enVuelo; ++i) {
+			void* buffer = nullptr;
+			if (posix_memalign(&buffer, ALINEACION, escritura->tamanioBuffer) != 0) {
+				CerrarEscrituraUring(escritura);
+				return nullptr;
+			}
+			escritura->buffers.push_back(static_cast<char*>(buffer));
+			escritura->libres.push_back(i);
+		}
+#ifdef URG_IO_URING
+		escritura->conAnillo = IniciarAnillo(escritura->anillo, enVuelo);
+		if (!escritura->conAnillo) {
+			LiberarAnillo(escritura->anillo);
+		}
+#endif
+		escritura->actual = TomarBufferLibre(escritura);
+		escritura->inicio = escritura->ultimaEscritura = Reloj::now();
+		return escritura;
+#endif
+	}
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring. @datos apunta a @largo bytes
+	 * Postcondicion: Copia @datos al buffer actual y envia cada buffer que se llena, esperando una escritura en vuelo
+	 * si no queda ningun buffer libre. Devuelve false si alguna escritura fallo
+	 */
+	bool Escribir(EscrituraUring* escritura, const char* datos, size_t largo) {
+#ifndef _WIN32
+		while (largo > 0) {
+			size_t copiar = std::min(largo, escritura->tamanioBuffer - escritura->usado);
+			std::memcpy(escritura->buffers[escritura->actual] + escritura->usado, datos, copiar);
+			escritura->usado += copiar;
+			datos += copiar;
+			largo -= copiar;
+			if (escritura->usado == escritura->tamanioBuffer) {
+				EnviarBuffer(escritura, escritura->actual, escritura->usado, escritura->offset);
+				escritura->offset += escritura->usado;
+				escritura->usado = 0;
+				escritura->actual = TomarBufferLibre(escritura);
+			}
+		}
+#else
+		(void)datos;
+		(void)largo;
+#endif
+		return !escritura->error;
+	}
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Envia lo acumulado y espera a que terminen todas las escrituras en vuelo.
+	 * Devuelve false si alguna escritura fallo
+	 */
+	bool Vaciar(EscrituraUring* escritura) {
+#ifndef _WIN32
+		if (escritura->directo) {
+			// O_DIRECT solo acepta bloques alineados: lo acumulado se escribe sin O_DIRECT pero queda en el buffer,
+			// y se vuelve a escribir alineado cuando el buffer se complete
+			EscribirCola(escritura);
+		}
+		else if (escritura->usado > 0) {
+			EnviarBuffer(escritura, escritura->actual, escritura->usado, escritura->offset);
+			escritura->offset += escritura->usado;
+			escritura->usado = 0;
+			escritura->actual = TomarBufferLibre(escritura);
+		}
+		EsperarTodas(escritura);
+#endif
+		return !escritura->error;
+	}
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Devuelve true si @escritura envia sus buffers por io_uring y false si usa pwrite. Pasa a false si
+	 * esperar en el anillo falla con un error que no es transitorio (esas escrituras en vuelo cuentan como fallidas)
+	 */
+	bool UsaIoUring(const EscrituraUring* escritura) {
+#ifdef URG_IO_URING
+		return escritura->conAnillo;
+#else
+		(void)escritura;
+		return false;
+#endif
+	}
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Devuelve los bytes por segundo que llegaron al archivo desde que se abrio hasta la ultima
+	 * escritura terminada (cero si todavia no termino ninguna)
+	 */
+	double ObtenerRendimiento(const EscrituraUring* escritura) {
+		double segundos = std::chrono::duration<double>(escritura->ultimaEscritura - escritura->inicio).count();
+		if (escritura->bytesEscritos == 0 || segundos <= 0) {
+			return 0;
+		}
+		return static_cast<double>(escritura->bytesEscritos) / segundos;
+	}
+
+	/*
+	 * Precondiciones: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondiciones: Vacia lo pendiente, cierra el archivo y libera todos los recursos asociados a @escritura.
+	 * Devuelve false si alguna escritura fallo
+	 */
+	bool CerrarEscrituraUring(EscrituraUring* escritura) {
+#ifndef _WIN32
+		if (!escritura->buffers.empty()) {
+			Vaciar(escritura);
+			if (escritura->directo && escritura->colaEscrita > 0) {
+				// Vaciar ya escribio la cola; solo falta contar lo que llego al archivo
+				escritura->bytesEscritos += escritura->colaEscrita;
+				escritura->ultimaEscritura = Reloj::now();
+			}
+		}
+#ifdef URG_IO_URING
+		LiberarAnillo(escritura->anillo);
+#endif
+		for (char* buffer : escritura->buffers) {
+			free(buffer);
+		}
+		if (escritura->descriptor != escritura->descriptorComun && close(escritura->descriptor) != 0) {
+			escritura->error = true;
+		}
+		if (close(escritura->descriptorComun) != 0) {
+			escritura->error = true;
+		}
+#endif
+		bool exito = !escritura->error;
+		delete escritura;
+		return exito;
+	}
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Desde ahora, cada vez que termina la escritura de un buffer se llama a @funcion con sus bytes, los
+	 * nanosegundos entre el envio y la terminacion y @contexto. Con @funcion NULL deja de avisar
+	 */
+	void AvisarEscrituras(EscrituraUring* escritura, FuncionEscrituraTerminada funcion, void* contexto) {
+		escritura->aviso = funcion;
+		escritura->contextoAviso = contexto;
+	}
+}
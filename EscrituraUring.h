@@ -0,0 +1,72 @@
+#ifndef ESCRITURAURING_H_
+#define ESCRITURAURING_H_
+
+#include <cstddef>
+#include <string>
+using std::string;
+
+namespace URGEscrituraUring{
+	/*
+	 * Archivo de solo escritura secuencial que envia buffers grandes y alineados por io_uring (Linux), con varias
+	 * escrituras en vuelo a la vez y sin hilos propios. Si io_uring no esta disponible escribe con pwrite.
+	 * Opcionalmente abre el archivo con O_DIRECT, salteando la cache de paginas
+	 */
+	struct EscrituraUring;
+
+	typedef void (*FuncionEscrituraTerminada)(size_t bytes, unsigned long long nanosegundos, void* contexto);
+
+	// Alineacion de buffers, largos y offsets que exige O_DIRECT
+	const size_t ALINEACION = 4096;
+
+	/*
+	 * Precondicion: @tamanioBuffer y @enVuelo son mayores que cero
+	 * Postcondicion: Crea (o trunca) @nombreArchivo y devuelve una instancia de EscrituraUring con @enVuelo buffers de
+	 * @tamanioBuffer bytes (redondeado a ALINEACION). Con @directo usa O_DIRECT si el sistema de archivos lo permite.
+	 * Si no se puede abrir el archivo devuelve NULL (siempre en plataformas sin pwrite)
+	 */
+	EscrituraUring* AbrirEscrituraUring(const string& nombreArchivo, size_t tamanioBuffer, unsigned int enVuelo, bool directo);
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring. @datos apunta a @largo bytes
+	 * Postcondicion: Copia @datos al buffer actual y envia cada buffer que se llena, esperando una escritura en vuelo
+	 * si no queda ningun buffer libre. Devuelve false si alguna escritura fallo
+	 */
+	bool Escribir(EscrituraUring* escritura, const char* datos, size_t largo);
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Envia lo acumulado y espera a que terminen todas las escrituras en vuelo.
+	 * Devuelve false si alguna escritura fallo
+	 */
+	bool Vaciar(EscrituraUring* escritura);
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Devuelve true si @escritura envia sus buffers por io_uring y false si usa pwrite. Pasa a false si
+	 * esperar en el anillo falla con un error que no es transitorio (esas escrituras en vuelo cuentan como fallidas)
+	 */
+	bool UsaIoUring(const EscrituraUring* escritura);
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Devuelve los bytes por segundo que llegaron al archivo desde que se abrio hasta la ultima
+	 * escritura terminada (cero si todavia no termino ninguna)
+	 */
+	double ObtenerRendimiento(const EscrituraUring* escritura);
+
+	/*
+	 * Precondicion: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondicion: Desde ahora, cada vez que termina la escritura de un buffer se llama a @funcion con sus bytes, los
+	 * nanosegundos entre el envio y la terminacion y @contexto. Con @funcion NULL deja de avisar
+	 */
+	void AvisarEscrituras(EscrituraUring* escritura, FuncionEscrituraTerminada funcion, void* contexto);
+
+	/*
+	 * Precondiciones: @escritura es una instancia valida creada con AbrirEscrituraUring
+	 * Postcondiciones: Vacia lo pendiente, cierra el archivo y libera todos los recursos asociados a @escritura.
+	 * Devuelve false si alguna escritura fallo
+	 */
+	bool CerrarEscrituraUring(EscrituraUring* escritura);
+}
+
+#endif
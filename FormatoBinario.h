@@ -0,0 +1,80 @@
+#ifndef FORMATOBINARIO_H_
+#define FORMATOBINARIO_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Formato binario .urgb del URG. Lo escribe URGSerializador::SerializarBinario y lo lee URGGrafo::CargarGrafoBinario.
+ * Todos los enteros de tamanio fijo son little endian. Disposicion del archivo:
+ * - Encabezado (64 bytes)
+ * - Nombre e identificador del grafo (sin terminador)
+ * - Offsets de filas: cantidadVertices + 1 enteros de 64 bits, alineados a 8. offsets[v]..offsets[v + 1]
+ *   delimita en bytes la fila de v dentro del bloque de filas
+ * - Filas (CSR comprimido): por vertice, varint con la cantidad de vecinos, el primer vecino y luego la
+ *   diferencia con el vecino anterior, cada uno como varint. Los vecinos van ordenados de menor a mayor
+ * - Etiquetas (opcional, alineada a 4): cantidad de etiquetas distintas L, L + 1 offsets de 32 bits sobre
+ *   los caracteres, el indice de etiqueta de cada vertice (UINT32_MAX si no tiene) y los caracteres
+ */
+namespace URGFormatoBinario{
+	const char MAGIA[4] = { 'U', 'R', 'G', 'B' };
+	const uint32_t VERSION = 1;
+	const uint32_t MARCA_ORDEN = 0x01020304;  // Se lee distinto si el archivo se escribio con otro orden de bytes
+	const uint32_t SIN_ETIQUETA = UINT32_MAX;
+
+	struct Encabezado {
+		char magia[4];
+		uint32_t version;
+		uint32_t marcaOrden;
+		uint32_t dirigido;            // 1 si el grafo es dirigido, 0 si no
+		uint32_t cantidadVertices;
+		uint32_t largoNombre;         // El nombre empieza justo despues del encabezado
+		uint32_t largoIdentificador;  // El identificador empieza justo despues del nombre
+		uint32_t reservado;
+		uint64_t cantidadEntradas;    // Total de vecinos guardados en las filas
+		uint64_t inicioOffsets;
+		uint64_t inicioFilas;
+		uint64_t inicioEtiquetas;     // 0 si el grafo no tiene etiquetas
+	};
+	static_assert(sizeof(Encabezado) == 64, "El encabezado del formato .urgb ocupa 64 bytes");
+
+	// Redondea @posicion hacia arriba al multiplo de @alineacion
+	inline uint64_t Alinear(uint64_t posicion, uint64_t alineacion) {
+		return (posicion + alineacion - 1) / alineacion * alineacion;
+	}
+
+	// Cantidad de bytes que ocupa @valor codificado como varint (7 bits por byte, el bit alto indica que sigue)
+	inline size_t LargoVarint(uint64_t valor) {
+		size_t largo = 1;
+		while (valor >= 0x80) {
+			valor >>= 7;
+			++largo;
+		}
+		return largo;
+	}
+
+	// Escribe @valor como varint a partir de @destino y devuelve la posicion siguiente
+	inline uint8_t* EscribirVarint(uint8_t* destino, uint64_t valor) {
+		while (valor >= 0x80) {
+			*destino++ = static_cast<uint8_t>(valor) | 0x80;
+			valor >>= 7;
+		}
+		*destino++ = static_cast<uint8_t>(valor);
+		return destino;
+	}
+
+	// Lee un varint a partir de @origen sin pasar de @fin. Devuelve la posicion siguiente o NULL si el varint esta cortado
+	inline const uint8_t* LeerVarint(const uint8_t* origen, const uint8_t* fin, uint64_t& valor) {
+		valor = 0;
+		for (unsigned int desplazamiento = 0; origen < fin && desplazamiento < 64; desplazamiento += 7) {
+			uint8_t byte = *origen++;
+			valor |= static_cast<uint64_t>(byte & 0x7F) << desplazamiento;
+			if ((byte & 0x80) == 0) {
+				return origen;
+			}
+		}
+		return nullptr;
+	}
+}
+
+#endif
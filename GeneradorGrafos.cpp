@@ -2,8 +2,13 @@
 #define GENERADORGRAFOS_H_
 #include<iostream>
 #include "Grafo.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <cstdlib>
 #include <ctime>
@@ -21,10 +26,44 @@ namespace URGGeneradorGrafos {
 	 * Postcondicion: Devuelve una instancia nueva de grafo con las siguientes caracteristicas
 	 * - Nombre: random_001 donde 001 sera el numero de llamadas realizadas a esta primitiva (la segunda vez sera 002)
 	 * - La cantidad de vertices del grafo es @vertices
-	 * - El tope maximo de aristas del grafo sera @maximaCantidadAristas y estas deben ser aleatorias
+	 * - Tiene exactamente min(@maximaCantidadAristas, @vertices * (@vertices - 1) / 2) aristas, elegidas al azar
+	 *   de manera uniforme entre todos los grafos simples con esa cantidad de aristas (ver ObtenerGrafoRandomAristas)
 	 */
 	Grafo* ObtenerGrafoRandom(unsigned int vertices, int maximaCantidadAristas);
 
+	/*
+	 * Precondicion: @probabilidad esta entre 0 y 1
+	 * Postcondicion: Devuelve un grafo no dirigido G(n, p) de nombre gnp_@vertices: cada uno de los pares de vertices
+	 * distintos es arista con probabilidad @probabilidad, independientemente de los demas. El tiempo es proporcional a
+	 * @vertices mas la cantidad de aristas generadas (no a la de pares), porque salta de arista en arista con saltos de
+	 * largo geometrico (Batagelj y Brandes). Los rangos de vertices se generan en @hilos hilos (0 usa todos los
+	 * disponibles), cada uno con su propio flujo pseudoaleatorio: el grafo depende solo de @semilla
+	 */
+	Grafo* ObtenerGrafoRandomProbabilidad(unsigned int vertices, double probabilidad, unsigned long long semilla, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un grafo no dirigido G(n, m) de nombre gnm_@vertices_@cantidadAristas con exactamente
+	 * min(@cantidadAristas, @vertices * (@vertices - 1) / 2) aristas, elegido de manera uniforme entre todos los grafos
+	 * simples con esa cantidad de aristas. Genera un G(n, p) con p apenas mayor a la necesaria y descarta al azar las
+	 * aristas que sobran. Los hilos y la semilla se usan igual que en ObtenerGrafoRandomProbabilidad
+	 */
+	Grafo* ObtenerGrafoRandomAristas(unsigned int vertices, unsigned long long cantidadAristas, unsigned long long semilla, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: @escala es menor a 31. @a, @b, @c y @d no son negativos y alguno es mayor que cero
+	 * Postcondicion: Devuelve un grafo no dirigido R-MAT (Kronecker, como el de Graph500) de nombre
+	 * rmat_@escala_@factorAristas, con 2^@escala vertices y @factorAristas * 2^@escala aristas. Cada arista baja
+	 * @escala niveles por la matriz de adyacencia eligiendo uno de sus cuatro cuadrantes con probabilidades
+	 * proporcionales a @a (arriba a la izquierda), @b, @c y @d (abajo a la derecha), lo que da grados muy
+	 * desparejos. Despues los vertices se renumeran con una permutacion al azar, para que los de mayor grado no
+	 * queden juntos. Como en Graph500 se conservan lazos y aristas repetidas; con @simple se descartan.
+	 * Los numeros al azar de cada arista salen de un contador (la semilla y el numero de arista), asi que los hilos
+	 * llenan rangos de aristas en cualquier orden y el grafo depende solo de @semilla (@hilos en 0 usa todos)
+	 */
+	Grafo* ObtenerGrafoRMAT(unsigned int escala, unsigned int factorAristas, unsigned long long semilla, double a = 0.57,
+		double b = 0.19, double c = 0.19, double d = 0.05, bool simple = false, unsigned int hilos = 0);
+
 	/*
 	 * Precondicion: ninguna
 	 * Postcondicion: Devuelve una instancia nueva de un grafo completo de una cantidad de vertices igual a @vertices
@@ -48,7 +87,185 @@ namespace URGGeneradorGrafos {
 	 */
 	Grafo* ObtenerGrafoPetersen();
 
-	//FALTA 
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un grafo completo implicito de @vertices vertices de nombre completo_@vertices, con
+	 * las mismas aristas que ObtenerGrafoCompleto pero sin listas de adyacencia (ver URGGrafo::GrafoImplicito)
+	 */
+	GrafoImplicito* ObtenerGrafoCompletoImplicito(unsigned int vertices);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un ciclo implicito de @vertices vertices de nombre ciclo_@vertices
+	 */
+	GrafoImplicito* ObtenerGrafoCicloImplicito(unsigned int vertices);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve una grilla implicita de @filas por @columnas de nombre grilla_@filas_@columnas, donde el
+	 * vertice de la fila f y la columna c es f * @columnas + c y es adyacente a sus vecinos de arriba, abajo y los costados
+	 */
+	GrafoImplicito* ObtenerGrafoGrillaImplicito(unsigned int filas, unsigned int columnas);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve el grafo de Petersen implicito de nombre petersen, numerado igual que ObtenerGrafoPetersen
+	 */
+	GrafoImplicito* ObtenerGrafoPetersenImplicito();
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve el bipartito completo implicito K_{@verticesA,@verticesB} de nombre
+	 * bipartito_completo_@verticesA_@verticesB. Los vertices 0 a @verticesA - 1 forman un lado y el resto el otro
+	 */
+	GrafoImplicito* ObtenerGrafoBipartitoCompletoImplicito(unsigned int verticesA, unsigned int verticesB);
+
+	// Cantidad de rangos de vertices en que se reparten los pares. Es fija para que el grafo no dependa de los hilos
+	const unsigned int BLOQUES_GENERACION = 256;
+
+	static unsigned int HilosDisponibles() {
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	// SplitMix64: deriva flujos independientes de una misma semilla
+	static unsigned long long MezclarSemilla(unsigned long long semilla, unsigned long long flujo) {
+		unsigned long long z = semilla + (flujo + 1) * 0x9E3779B97F4A7C15ULL;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	// Uniforme en [0, 1) con los 53 bits altos de @bits
+	static double Uniforme(unsigned long long bits) {
+		return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+	// Semilla para las primitivas sin semilla explicita: el random_device se consulta una sola vez
+	static unsigned long long SemillaAleatoria() {
+		static std::mt19937_64 generador(std::random_device{}());
+		return generador();
+	}
+
+	static unsigned long long CantidadPares(unsigned int vertices) {
+		return static_cast<unsigned long long>(vertices) * (vertices > 0 ? vertices - 1 : 0) / 2;
+	}
+
+	/*
+	 * Aristas de G(n, p) con origen en [desde, hasta), siempre con destino < origen. En lugar de sortear cada par
+	 * se sortea el largo del salto hasta la proxima arista, que tiene distribucion geometrica (Batagelj y Brandes)
+	 */
+	static void GenerarAristasRango(int desde, int hasta, double probabilidad, unsigned long long semilla,
+		vector<std::pair<int, int>>& aristas) {
+		if (probabilidad >= 1) {
+			for (int vertice = desde; vertice < hasta; ++vertice) {
+				for (int vecino = 0; vecino < vertice; ++vecino) {
+					aristas.emplace_back(vertice, vecino);
+				}
+			}
+			return;
+		}
+		double inversoLogaritmo = 1 / std::log1p(-probabilidad);
+		std::mt19937_64 generador(semilla);
+		long long vertice = std::max(desde, 1);
+		long long vecino = -1;
+		while (vertice < hasta) {
+			double salto = std::floor(std::log1p(-Uniforme(generador())) * inversoLogaritmo);
+			double paresRestantes = (static_cast<double>(hasta) * (hasta - 1) - static_cast<double>(vertice) * (vertice - 1)) / 2
+				- static_cast<double>(vecino + 1);
+			if (salto >= paresRestantes) {
+				return;
+			}
+			vecino += 1 + static_cast<long long>(salto);
+			while (vecino >= vertice && vertice < hasta) {
+				vecino -= vertice;
+				++vertice;
+			}
+			if (vertice < hasta) {
+				aristas.emplace_back(static_cast<int>(vertice), static_cast<int>(vecino));
+			}
+		}
+	}
+
+	/*
+	 * Aristas de G(n, p) en un orden que solo depende de @semilla: los vertices se reparten en BLOQUES_GENERACION
+	 * rangos con una cantidad parecida de pares, cada uno con su flujo, y los hilos toman rangos a medida que terminan
+	 */
+	static vector<std::pair<int, int>> GenerarAristasProbabilidad(unsigned int vertices, double probabilidad,
+		unsigned long long semilla, unsigned int hilos) {
+		vector<std::pair<int, int>> aristas;
+		if (vertices < 2 || probabilidad <= 0) {
+			return aristas;
+		}
+		// Los pares con origen menor a v son v * (v - 1) / 2: los limites van como la raiz para repartirlos parejo
+		vector<int> limites(BLOQUES_GENERACION + 1);
+		for (unsigned int bloque = 0; bloque <= BLOQUES_GENERACION; ++bloque) {
+			limites[bloque] = static_cast<int>(std::llround(vertices * std::sqrt(static_cast<double>(bloque) / BLOQUES_GENERACION)));
+		}
+		limites[BLOQUES_GENERACION] = static_cast<int>(vertices);
+
+		vector<vector<std::pair<int, int>>> porBloque(BLOQUES_GENERACION);
+		std::atomic<unsigned int> siguiente(0);
+		auto trabajar = [&]() {
+			for (unsigned int bloque = siguiente++; bloque < BLOQUES_GENERACION; bloque = siguiente++) {
+				double esperadas = probabilidad * (static_cast<double>(limites[bloque + 1]) * (limites[bloque + 1] - 1) -
+					static_cast<double>(limites[bloque]) * (limites[bloque] - 1)) / 2;
+				porBloque[bloque].reserve(static_cast<size_t>(esperadas * 1.05) + 16);
+				GenerarAristasRango(limites[bloque], limites[bloque + 1], probabilidad, MezclarSemilla(semilla, bloque), porBloque[bloque]);
+			}
+		};
+		hilos = std::min(hilos == 0 ? HilosDisponibles() : hilos, BLOQUES_GENERACION);
+		vector<std::thread> trabajadores;
+		for (unsigned int i = 1; i < hilos; ++i) {
+			trabajadores.emplace_back(trabajar);
+		}
+		trabajar();
+		for (std::thread& trabajador : trabajadores) {
+			trabajador.join();
+		}
+
+		size_t total = 0;
+		for (const vector<std::pair<int, int>>& bloque : porBloque) {
+			total += bloque.size();
+		}
+		aristas.reserve(total);
+		for (vector<std::pair<int, int>>& bloque : porBloque) {
+			aristas.insert(aristas.end(), bloque.begin(), bloque.end());
+			vector<std::pair<int, int>>().swap(bloque);
+		}
+		return aristas;
+	}
+
+	/*
+	 * Exactamente min(@cantidadAristas, pares) aristas distintas, uniformes: un G(n, p) condicionado a k aristas es
+	 * uniforme entre los grafos de k aristas, y quedarse con un subconjunto uniforme de m de ellas lo sigue siendo.
+	 * p se elige unos desvios por encima de m / pares, asi que casi nunca hace falta repetir
+	 */
+	static vector<std::pair<int, int>> GenerarAristasCantidad(unsigned int vertices, unsigned long long cantidadAristas,
+		unsigned long long semilla, unsigned int hilos) {
+		unsigned long long pares = CantidadPares(vertices);
+		cantidadAristas = std::min(cantidadAristas, pares);
+		if (cantidadAristas == 0) {
+			return vector<std::pair<int, int>>();
+		}
+		double objetivo = static_cast<double>(cantidadAristas);
+		double margen = 6 * std::sqrt(objetivo) + 16;
+		for (unsigned long long intento = 0;; ++intento) {
+			double probabilidad = std::min(1.0, (objetivo + margen) / static_cast<double>(pares));
+			vector<std::pair<int, int>> aristas = GenerarAristasProbabilidad(vertices, probabilidad, MezclarSemilla(semilla, intento), hilos);
+			if (aristas.size() >= cantidadAristas) {
+				// Fisher-Yates parcial desde el final: las que sobran pasan al final, elegidas al azar
+				std::mt19937_64 generador(MezclarSemilla(~semilla, intento));
+				for (size_t restantes = aristas.size(); restantes > cantidadAristas; --restantes) {
+					std::uniform_int_distribution<size_t> posicion(0, restantes - 1);
+					std::swap(aristas[posicion(generador)], aristas[restantes - 1]);
+				}
+				aristas.resize(static_cast<size_t>(cantidadAristas));
+				return aristas;
+			}
+			margen *= 2;
+		}
+	}
+
 	Grafo* ObtenerGrafoRandom(unsigned int vertices, int maximaCantidadAristas) {
 		llamadasRandom++;
 
@@ -56,41 +273,112 @@ namespace URGGeneradorGrafos {
 		numeroFormateado = string(3 - numeroFormateado.length(), '0') + numeroFormateado;
 		string nombre = "random_" + numeroFormateado;
 
-		Grafo* grafo = CrearGrafoNoDirigido(nombre, vertices);
+		Grafo* grafo = CrearGrafoNoDirigido(std::move(nombre), vertices);
+		CambiarModoAdyacencia(grafo, ORDENADA);
+
+		unsigned long long cantidadAristas = maximaCantidadAristas > 0 ? static_cast<unsigned long long>(maximaCantidadAristas) : 0;
+		vector<std::pair<int, int>> aristas = GenerarAristasCantidad(vertices, cantidadAristas, SemillaAleatoria(), 1);
+		ConectarLote(grafo, aristas.data(), aristas.size());
+
+		return grafo;
+	}
 
-		std::random_device rd;
-		std::mt19937 gen(rd());
-		std::uniform_int_distribution<> vertice_dist(0, vertices - 1);
+	Grafo* ObtenerGrafoRandomProbabilidad(unsigned int vertices, double probabilidad, unsigned long long semilla, unsigned int hilos) {
+		Grafo* grafo = CrearGrafoNoDirigido("gnp_" + std::to_string(vertices), vertices);
+		vector<std::pair<int, int>> aristas = GenerarAristasProbabilidad(vertices, probabilidad, semilla, hilos);
+		ConectarLote(grafo, aristas.data(), aristas.size());
+		return grafo;
+	}
 
-		int intentos = 0;
-		int aristasCreadas = 0;
-		const int maxIntentos = maximaCantidadAristas * 2;
+	Grafo* ObtenerGrafoRandomAristas(unsigned int vertices, unsigned long long cantidadAristas, unsigned long long semilla, unsigned int hilos) {
+		Grafo* grafo = CrearGrafoNoDirigido("gnm_" + std::to_string(vertices) + "_" + std::to_string(cantidadAristas), vertices);
+		vector<std::pair<int, int>> aristas = GenerarAristasCantidad(vertices, cantidadAristas, semilla, hilos);
+		ConectarLote(grafo, aristas.data(), aristas.size());
+		return grafo;
+	}
 
-		while (aristasCreadas < maximaCantidadAristas && intentos < maxIntentos) {
-			int vertice1 = vertice_dist(gen);
-			int vertice2 = vertice_dist(gen);
 
-			if (vertice1 != vertice2 && !SonAdyacentes(grafo, vertice1, vertice2)) {
-				Conectar(grafo, vertice1, vertice2);
-				aristasCreadas++;
+	Grafo* ObtenerGrafoRMAT(unsigned int escala, unsigned int factorAristas, unsigned long long semilla, double a,
+		double b, double c, double d, bool simple, unsigned int hilos) {
+		string nombre = "rmat_" + std::to_string(escala) + "_" + std::to_string(factorAristas);
+		int vertices = 1 << escala;
+		Grafo* grafo = CrearGrafoNoDirigido(std::move(nombre), vertices);
+
+		// Probabilidades acumuladas de los cuadrantes (a | a + b | a + b + c) como umbrales sobre sorteos de 32 bits
+		double total = a + b + c + d;
+		const double ESCALA_SORTEO = 4294967296.0;
+		unsigned long long hastaA = static_cast<unsigned long long>(a / total * ESCALA_SORTEO);
+		unsigned long long hastaB = static_cast<unsigned long long>((a + b) / total * ESCALA_SORTEO);
+		unsigned long long hastaC = static_cast<unsigned long long>((a + b + c) / total * ESCALA_SORTEO);
+
+		size_t cantidadAristas = static_cast<size_t>(factorAristas) << escala;
+		vector<std::pair<int, int>> aristas(cantidadAristas);
+		auto generarRango = [&](size_t desde, size_t hasta) {
+			for (size_t arista = desde; arista < hasta; ++arista) {
+				unsigned int origen = 0;
+				unsigned int destino = 0;
+				// Cada valor del contador da dos sorteos de 32 bits, uno por nivel
+				unsigned long long contador = static_cast<unsigned long long>(arista) * ((escala + 1) / 2);
+				unsigned long long bits = 0;
+				for (unsigned int nivel = 0; nivel < escala; ++nivel) {
+					if (nivel % 2 == 0) {
+						bits = MezclarSemilla(semilla, contador + nivel / 2);
+					}
+					unsigned long long sorteo = (bits >> (32 * (nivel % 2))) & 0xFFFFFFFFULL;
+					// Cuadrante 0 (a), 1 (b), 2 (c) o 3 (d) sin saltos condicionales, que aca se predicen muy mal.
+					// El bit alto elige la mitad de abajo (origen) y el bajo la de la derecha (destino)
+					unsigned int cuadrante = (sorteo >= hastaA) + (sorteo >= hastaB) + (sorteo >= hastaC);
+					origen = (origen << 1) | (cuadrante >> 1);
+					destino = (destino << 1) | (cuadrante & 1);
+				}
+				aristas[arista] = std::make_pair(static_cast<int>(origen), static_cast<int>(destino));
 			}
-			intentos++;
+		};
+		hilos = hilos == 0 ? HilosDisponibles() : hilos;
+		hilos = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(hilos, cantidadAristas / 4096)));
+		vector<std::thread> trabajadores;
+		for (unsigned int i = 1; i < hilos; ++i) {
+			trabajadores.emplace_back(generarRango, cantidadAristas * i / hilos, cantidadAristas * (i + 1) / hilos);
+		}
+		generarRango(0, cantidadAristas / hilos);
+		for (std::thread& trabajador : trabajadores) {
+			trabajador.join();
 		}
 
+		vector<int> permutacion(vertices);
+		for (int vertice = 0; vertice < vertices; ++vertice) {
+			permutacion[vertice] = vertice;
+		}
+		std::mt19937_64 generador(MezclarSemilla(~semilla, 0));
+		for (int vertice = vertices - 1; vertice > 0; --vertice) {
+			std::uniform_int_distribution<int> posicion(0, vertice);
+			std::swap(permutacion[vertice], permutacion[posicion(generador)]);
+		}
+		size_t destino = 0;
+		for (size_t arista = 0; arista < cantidadAristas; ++arista) {
+			std::pair<int, int> renumerada(permutacion[aristas[arista].first], permutacion[aristas[arista].second]);
+			if (!simple || renumerada.first != renumerada.second) {
+				aristas[destino++] = renumerada;
+			}
+		}
+		aristas.resize(destino);
+		ConectarLote(grafo, aristas.data(), aristas.size(), simple);
 		return grafo;
 	}
 
-
 	Grafo* ObtenerGrafoCompleto(unsigned int vertices) {
 
 		string nombre = "completo_" + std::to_string(vertices);
-		Grafo* grafo = CrearGrafoNoDirigido(nombre, vertices);
+		Grafo* grafo = CrearGrafoNoDirigido(std::move(nombre), vertices);
 
+		vector<std::pair<int, int>> aristas;
+		aristas.reserve(size_t(vertices) * (vertices > 0 ? vertices - 1 : 0) / 2);
 		for (unsigned int verticeOrigen = 0; verticeOrigen < vertices; ++verticeOrigen) {
 			for (unsigned int verticeDestino = verticeOrigen + 1; verticeDestino < vertices; ++verticeDestino) {
-				Conectar(grafo, verticeOrigen, verticeDestino);
+				aristas.emplace_back(verticeOrigen, verticeDestino);
 			}
 		}
+		ConectarLote(grafo, aristas.data(), aristas.size());
 
 		return grafo;
 	}
@@ -211,7 +499,7 @@ namespace URGGeneradorGrafos {
 
 	Grafo* ObtenerGrafoPetersen() {
 		string nombre = "petersen";
-		Grafo* grafo = CrearGrafoNoDirigido(nombre, 10);
+		Grafo* grafo = CrearGrafoNoDirigido(std::move(nombre), 10);
 
 
 		Conectar(grafo, 0, 1);
@@ -236,5 +524,35 @@ namespace URGGeneradorGrafos {
 
 		return grafo;
 	}
+
+
+	GrafoImplicito* ObtenerGrafoCompletoImplicito(unsigned int vertices) {
+		return CrearGrafoImplicito("completo_" + std::to_string(vertices), IMPLICITO_COMPLETO, static_cast<int>(vertices));
+	}
+
+	GrafoImplicito* ObtenerGrafoCicloImplicito(unsigned int vertices) {
+		return CrearGrafoImplicito("ciclo_" + std::to_string(vertices), IMPLICITO_CICLO, static_cast<int>(vertices));
+	}
+
+	GrafoImplicito* ObtenerGrafoGrillaImplicito(unsigned int filas, unsigned int columnas) {
+		// Se controla antes de convertir los parametros a int, que cambiaria los que no entran
+		if (static_cast<unsigned long long>(filas) * columnas > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+			return nullptr;
+		}
+		string nombre = "grilla_" + std::to_string(filas) + "_" + std::to_string(columnas);
+		return CrearGrafoImplicito(std::move(nombre), IMPLICITO_GRILLA, static_cast<int>(filas), static_cast<int>(columnas));
+	}
+
+	GrafoImplicito* ObtenerGrafoPetersenImplicito() {
+		return CrearGrafoImplicito("petersen", IMPLICITO_PETERSEN);
+	}
+
+	GrafoImplicito* ObtenerGrafoBipartitoCompletoImplicito(unsigned int verticesA, unsigned int verticesB) {
+		if (static_cast<unsigned long long>(verticesA) + verticesB > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+			return nullptr;
+		}
+		string nombre = "bipartito_completo_" + std::to_string(verticesA) + "_" + std::to_string(verticesB);
+		return CrearGrafoImplicito(std::move(nombre), IMPLICITO_BIPARTITO_COMPLETO, static_cast<int>(verticesA), static_cast<int>(verticesB));
+	}
 }
 #endif
\ No newline at end of file
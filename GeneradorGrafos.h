@@ -3,6 +3,7 @@
 
 #include "Grafo.h"
 using URGGrafo::Grafo;
+using URGGrafo::GrafoImplicito;
 
 namespace URGGeneradorGrafos{
 	/*
@@ -10,10 +11,44 @@ namespace URGGeneradorGrafos{
 	 * Postcondicion: Devuelve una instancia nueva de grafo con las siguientes caracteristicas
 	 * - Nombre: random_001 donde 001 sera el numero de llamadas realizadas a esta primitiva (la segunda vez sera 002)
 	 * - La cantidad de vertices del grafo es @vertices
-	 * - El tope maximo de aristas del grafo sera @maximaCantidadAristas y estas deben ser aleatorias
+	 * - Tiene exactamente min(@maximaCantidadAristas, @vertices * (@vertices - 1) / 2) aristas, elegidas al azar
+	 *   de manera uniforme entre todos los grafos simples con esa cantidad de aristas (ver ObtenerGrafoRandomAristas)
 	 */
 	Grafo* ObtenerGrafoRandom(unsigned int vertices, int maximaCantidadAristas =0);
 
+	/*
+	 * Precondicion: @probabilidad esta entre 0 y 1
+	 * Postcondicion: Devuelve un grafo no dirigido G(n, p) de nombre gnp_@vertices: cada uno de los pares de vertices
+	 * distintos es arista con probabilidad @probabilidad, independientemente de los demas. El tiempo es proporcional a
+	 * @vertices mas la cantidad de aristas generadas (no a la de pares), porque salta de arista en arista con saltos de
+	 * largo geometrico (Batagelj y Brandes). Los rangos de vertices se generan en @hilos hilos (0 usa todos los
+	 * disponibles), cada uno con su propio flujo pseudoaleatorio: el grafo depende solo de @semilla
+	 */
+	Grafo* ObtenerGrafoRandomProbabilidad(unsigned int vertices, double probabilidad, unsigned long long semilla, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un grafo no dirigido G(n, m) de nombre gnm_@vertices_@cantidadAristas con exactamente
+	 * min(@cantidadAristas, @vertices * (@vertices - 1) / 2) aristas, elegido de manera uniforme entre todos los grafos
+	 * simples con esa cantidad de aristas. Genera un G(n, p) con p apenas mayor a la necesaria y descarta al azar las
+	 * aristas que sobran. Los hilos y la semilla se usan igual que en ObtenerGrafoRandomProbabilidad
+	 */
+	Grafo* ObtenerGrafoRandomAristas(unsigned int vertices, unsigned long long cantidadAristas, unsigned long long semilla, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: @escala es menor a 31. @a, @b, @c y @d no son negativos y alguno es mayor que cero
+	 * Postcondicion: Devuelve un grafo no dirigido R-MAT (Kronecker, como el de Graph500) de nombre
+	 * rmat_@escala_@factorAristas, con 2^@escala vertices y @factorAristas * 2^@escala aristas. Cada arista baja
+	 * @escala niveles por la matriz de adyacencia eligiendo uno de sus cuatro cuadrantes con probabilidades
+	 * proporcionales a @a (arriba a la izquierda), @b, @c y @d (abajo a la derecha), lo que da grados muy
+	 * desparejos. Despues los vertices se renumeran con una permutacion al azar, para que los de mayor grado no
+	 * queden juntos. Como en Graph500 se conservan lazos y aristas repetidas; con @simple se descartan.
+	 * Los numeros al azar de cada arista salen de un contador (la semilla y el numero de arista), asi que los hilos
+	 * llenan rangos de aristas en cualquier orden y el grafo depende solo de @semilla (@hilos en 0 usa todos)
+	 */
+	Grafo* ObtenerGrafoRMAT(unsigned int escala, unsigned int factorAristas, unsigned long long semilla, double a = 0.57,
+		double b = 0.19, double c = 0.19, double d = 0.05, bool simple = false, unsigned int hilos = 0);
+
 	/*
 	 * Precondicion: ninguna
 	 * Postcondicion: Devuelve una instancia nueva de un grafo completo de una cantidad de vertices igual a @vertices
@@ -36,6 +71,41 @@ namespace URGGeneradorGrafos{
 	 * Postcondicion: Devuelve una instancia nueva de el grafo de Petersen de nombre petersen
 	 */
 	Grafo* ObtenerGrafoPetersen();
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un grafo completo implicito de @vertices vertices de nombre completo_@vertices, con
+	 * las mismas aristas que ObtenerGrafoCompleto pero sin listas de adyacencia (ver URGGrafo::GrafoImplicito)
+	 */
+	GrafoImplicito* ObtenerGrafoCompletoImplicito(unsigned int vertices);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve un ciclo implicito de @vertices vertices de nombre ciclo_@vertices
+	 */
+	GrafoImplicito* ObtenerGrafoCicloImplicito(unsigned int vertices);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve una grilla implicita de @filas por @columnas de nombre grilla_@filas_@columnas, donde el
+	 * vertice de la fila f y la columna c es f * @columnas + c y es adyacente a sus vecinos de arriba, abajo y los costados.
+	 * Devuelve NULL si @filas * @columnas no entra en un int
+	 */
+	GrafoImplicito* ObtenerGrafoGrillaImplicito(unsigned int filas, unsigned int columnas);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve el grafo de Petersen implicito de nombre petersen, numerado igual que ObtenerGrafoPetersen
+	 */
+	GrafoImplicito* ObtenerGrafoPetersenImplicito();
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Devuelve el bipartito completo implicito K_{@verticesA,@verticesB} de nombre
+	 * bipartito_completo_@verticesA_@verticesB. Los vertices 0 a @verticesA - 1 forman un lado y el resto el otro.
+	 * Devuelve NULL si @verticesA + @verticesB no entra en un int
+	 */
+	GrafoImplicito* ObtenerGrafoBipartitoCompletoImplicito(unsigned int verticesA, unsigned int verticesB);
 }
 
 #endif
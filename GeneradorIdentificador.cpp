@@ -1,9 +1,108 @@
 // archivo GeneradorIdentificador.cpp
 #include "GeneradorIdentificador.h"
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
+#include <random>
+#include <thread>
 
 namespace URGGeneradorIdentificador {
+    static const char CARACTERES[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    static const unsigned int CANTIDAD_CARACTERES = sizeof(CARACTERES) - 1;
+    // Mayor multiplo de CANTIDAD_CARACTERES que entra en un byte: los bytes desde ahi se descartan para no sesgar
+    static const unsigned int LIMITE_BYTE = 256 / CANTIDAD_CARACTERES * CANTIDAD_CARACTERES;
+    static const char FORMATO[] = "########-####-####-########";
+    // Caracteres del identificador que codifican el contador en modo IDENTIFICADOR_SIN_COLISIONES: 36^13 > 2^64
+    static const int DIGITOS_CONTADOR = 13;
+
+    static std::atomic<int> modoActual(IDENTIFICADOR_ALEATORIO);
+    static std::atomic<uint64_t> contador(0);
+
+    // Finalizador de SplitMix64: biyectivo en 64 bits, asi que valores distintos del contador dan resultados distintos
+    static uint64_t Mezclar(uint64_t valor) {
+        valor = (valor ^ (valor >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        valor = (valor ^ (valor >> 27)) * 0x94D049BB133111EBULL;
+        return valor ^ (valor >> 31);
+    }
+
+    static uint64_t Rotar(uint64_t valor, int bits) {
+        return (valor << bits) | (valor >> (64 - bits));
+    }
+
+    // Estado de xoshiro256** de cada hilo. Se siembra una vez por hilo con random_device y el id del hilo
+    struct GeneradorHilo {
+        uint64_t estado[4];
+
+        GeneradorHilo() {
+            std::random_device dispositivo;
+            uint64_t semilla = (static_cast<uint64_t>(dispositivo()) << 32) ^ dispositivo() ^
+                std::hash<std::thread::id>()(std::this_thread::get_id());
+            for (uint64_t& palabra : estado) {
+                semilla += 0x9E3779B97F4A7C15ULL;
+                palabra = Mezclar(semilla);
+            }
+        }
+
+        uint64_t Siguiente() {
+            uint64_t resultado = Rotar(estado[1] * 5, 7) * 9;
+            uint64_t t = estado[1] << 17;
+            estado[2] ^= estado[0];
+            estado[3] ^= estado[1];
+            estado[1] ^= estado[2];
+            estado[0] ^= estado[3];
+            estado[2] ^= t;
+            estado[3] = Rotar(estado[3], 45);
+            return resultado;
+        }
+    };
+
+    static GeneradorHilo& GeneradorDelHilo() {
+        thread_local GeneradorHilo generador;
+        return generador;
+    }
+
+    // Clave del proceso para el modo sin colisiones: los contadores de dos procesos no dan la misma secuencia
+    static uint64_t ClaveProceso() {
+        static const uint64_t clave = std::random_device()() | (static_cast<uint64_t>(std::random_device()()) << 32);
+        return clave;
+    }
+
+    /*
+     * Llena los '#' de FORMATO en @destino con caracteres uniformes: cada byte del generador menor a LIMITE_BYTE da un
+     * caracter y los demas se descartan (un 1.6% de los bytes). Si @contador no es NULL, los primeros DIGITOS_CONTADOR
+     * '#' son los digitos en base 36 de Mezclar(*@contador)
+     */
+    static void EscribirIdentificador(char* destino, GeneradorHilo& generador, const uint64_t* valorContador) {
+        uint64_t codificado = valorContador != nullptr ? Mezclar(*valorContador ^ ClaveProceso()) : 0;
+        int digitosContador = valorContador != nullptr ? DIGITOS_CONTADOR : 0;
+        uint64_t bits = 0;
+        int bytesDisponibles = 0;
+        for (size_t i = 0; i < LARGO_IDENTIFICADOR; ++i) {
+            if (FORMATO[i] != '#') {
+                destino[i] = FORMATO[i];
+                continue;
+            }
+            if (digitosContador > 0) {
+                destino[i] = CARACTERES[codificado % CANTIDAD_CARACTERES];
+                codificado /= CANTIDAD_CARACTERES;
+                --digitosContador;
+                continue;
+            }
+            unsigned int byte;
+            do {
+                if (bytesDisponibles == 0) {
+                    bits = generador.Siguiente();
+                    bytesDisponibles = 8;
+                }
+                byte = static_cast<unsigned int>(bits & 0xFF);
+                bits >>= 8;
+                --bytesDisponibles;
+            } while (byte >= LIMITE_BYTE);
+            destino[i] = CARACTERES[byte % CANTIDAD_CARACTERES];
+        }
+    }
+
     /*
 	 * Precondicion: -
 	 * Postcondicion: Devuelve un string unico que tiene el siguiente formato
@@ -14,19 +113,41 @@ namespace URGGeneradorIdentificador {
 	 * donde cada valor del identificador debe tener una probabilidad uniforme de aparecer.
 	 */
     string GenerarIdentificadorUnico() {
-        const char caracteres[] = "abcdefghijklmnopqrstuvwxyz0123456789";
-        int longitud = sizeof(caracteres) - 1;
-        std::string id_formato = "########-####-####-########";
-        std::string identificador;
-
-        for (unsigned int i = 0; i < id_formato.length(); i++) {
-            if (id_formato[i] == '#') {
-                identificador += caracteres[rand() % longitud];
-            } else {
-                identificador += id_formato[i];
-            }
+        char identificador[LARGO_IDENTIFICADOR];
+        GenerarIdentificadorUnico(identificador);
+        return string(identificador, LARGO_IDENTIFICADOR);
+    }
+
+    /*
+     * Precondicion: @destino apunta a por lo menos LARGO_IDENTIFICADOR caracteres
+     * Postcondicion: Escribe en @destino un identificador con el formato de GenerarIdentificadorUnico, sin reservar
+     * memoria y sin agregar el caracter nulo. Se puede llamar desde varios hilos a la vez
+     */
+    void GenerarIdentificadorUnico(char* destino) {
+        GenerarIdentificadoresUnicos(destino, 1);
+    }
+
+    /*
+     * Precondicion: @destino apunta a por lo menos @cantidad * LARGO_IDENTIFICADOR caracteres
+     * Postcondicion: Escribe @cantidad identificadores seguidos en @destino, sin separadores ni caracter nulo.
+     * En modo IDENTIFICADOR_SIN_COLISIONES reserva los @cantidad valores del contador de una sola vez
+     */
+    void GenerarIdentificadoresUnicos(char* destino, size_t cantidad) {
+        GeneradorHilo& generador = GeneradorDelHilo();
+        bool sinColisiones = modoActual.load(std::memory_order_relaxed) == IDENTIFICADOR_SIN_COLISIONES;
+        uint64_t primero = sinColisiones ? contador.fetch_add(cantidad, std::memory_order_relaxed) : 0;
+        for (size_t i = 0; i < cantidad; ++i) {
+            uint64_t valor = primero + i;
+            EscribirIdentificador(destino + i * LARGO_IDENTIFICADOR, generador, sinColisiones ? &valor : nullptr);
         }
+    }
 
-        return identificador;
+    /*
+     * Precondicion: -
+     * Postcondicion: Los identificadores que se generen desde ahora, en cualquier hilo, usan el modo @modo.
+     * Al empezar el modo es IDENTIFICADOR_ALEATORIO
+     */
+    void CambiarModoIdentificador(ModoIdentificador modo) {
+        modoActual.store(modo, std::memory_order_relaxed);
     }
 }
@@ -1,11 +1,44 @@
 #ifndef GENERADORIDENTIFICADOR_H_
 #define GENERADORIDENTIFICADOR_H_
 
+#include <cstddef>
 #include <string>
 using std::string;
 
 namespace URGGeneradorIdentificador{
+    // Largo del identificador: ########-####-####-########
+    const size_t LARGO_IDENTIFICADOR = 27;
+
+    /*
+     * Como se eligen los caracteres de los identificadores:
+     * - IDENTIFICADOR_ALEATORIO: todos al azar, con un generador propio de cada hilo
+     * - IDENTIFICADOR_SIN_COLISIONES: 13 caracteres codifican un contador global pasado por una funcion biyectiva,
+     *   asi que dos identificadores del mismo proceso nunca son iguales; el resto sigue siendo al azar
+     */
+    enum ModoIdentificador { IDENTIFICADOR_ALEATORIO, IDENTIFICADOR_SIN_COLISIONES };
+
     string GenerarIdentificadorUnico();  // Solo la declaración
+
+    /*
+     * Precondicion: @destino apunta a por lo menos LARGO_IDENTIFICADOR caracteres
+     * Postcondicion: Escribe en @destino un identificador con el formato de GenerarIdentificadorUnico, sin reservar
+     * memoria y sin agregar el caracter nulo. Se puede llamar desde varios hilos a la vez
+     */
+    void GenerarIdentificadorUnico(char* destino);
+
+    /*
+     * Precondicion: @destino apunta a por lo menos @cantidad * LARGO_IDENTIFICADOR caracteres
+     * Postcondicion: Escribe @cantidad identificadores seguidos en @destino, sin separadores ni caracter nulo.
+     * En modo IDENTIFICADOR_SIN_COLISIONES reserva los @cantidad valores del contador de una sola vez
+     */
+    void GenerarIdentificadoresUnicos(char* destino, size_t cantidad);
+
+    /*
+     * Precondicion: -
+     * Postcondicion: Los identificadores que se generen desde ahora, en cualquier hilo, usan el modo @modo.
+     * Al empezar el modo es IDENTIFICADOR_ALEATORIO
+     */
+    void CambiarModoIdentificador(ModoIdentificador modo);
 }
 
 #endif
\ No newline at end of file
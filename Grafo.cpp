@@ -1,41 +1,403 @@
 #include "Grafo.h"
+#include "GrafoT.h"
 #include "GeneradorIdentificador.h"
+#include "ArchivoMapeado.h"
+#include "FormatoBinario.h"
 #include <vector>
 #include <list>
 #include <string>
 #include <algorithm>  // Para std::max
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <limits>
 #include <unordered_map>
 #include <sstream>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <variant>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 using namespace URGGeneradorIdentificador;
 using namespace std;
 using namespace URGGrafo;
 
 namespace URGGrafo {
+	const uint32_t SIN_ETIQUETA = UINT32_MAX;
+
+	/*
+	 * Etiquetas de los vertices de un grafo. Cada etiqueta distinta se guarda una sola vez (internada)
+	 * dentro de un unico buffer de caracteres; offsets marca donde empieza y termina cada una
+	 */
+	struct TablaEtiquetas {
+		string caracteres;                               // Etiqueta i: caracteres[offsets[i], offsets[i + 1])
+		vector<uint32_t> offsets = vector<uint32_t>(1, 0);
+		vector<uint32_t> etiquetaDeVertice;              // Indice de la etiqueta de cada vertice o SIN_ETIQUETA. Vacio hasta la primera etiqueta
+		vector<int> verticeDeEtiqueta;                   // Indice inverso: ultimo vertice que recibio cada etiqueta y la conserva, o -1
+		// Con verticeDeEtiqueta como cola, cada etiqueta tiene una lista doblemente enlazada de los vertices que la
+		// conservan, en el orden en que la recibieron. Un vertice tiene a lo sumo una etiqueta, asi que alcanza con
+		// un enlace de cada lado por vertice (-1 en los extremos). Vacios hasta la primera etiqueta
+		vector<int> anteriorConEtiqueta;
+		vector<int> siguienteConEtiqueta;
+		std::unordered_multimap<size_t, uint32_t> indice; // Hash de la etiqueta -> indice de la etiqueta
+	};
+
+	static std::string_view VerEtiqueta(const TablaEtiquetas& tabla, uint32_t etiqueta) {
+		return std::string_view(tabla.caracteres.data() + tabla.offsets[etiqueta], tabla.offsets[etiqueta + 1] - tabla.offsets[etiqueta]);
+	}
+
+	/*
+	 * Devuelve el indice de @texto en la tabla o SIN_ETIQUETA si nunca se interno
+	 */
+	static uint32_t BuscarEtiqueta(const TablaEtiquetas& tabla, std::string_view texto) {
+		auto candidatas = tabla.indice.equal_range(std::hash<std::string_view>()(texto));
+		for (auto candidata = candidatas.first; candidata != candidatas.second; ++candidata) {
+			if (VerEtiqueta(tabla, candidata->second) == texto) {
+				return candidata->second;
+			}
+		}
+		return SIN_ETIQUETA;
+	}
+
+	static uint32_t InternarEtiqueta(TablaEtiquetas& tabla, std::string_view texto) {
+		uint32_t etiqueta = BuscarEtiqueta(tabla, texto);
+		if (etiqueta == SIN_ETIQUETA) {
+			etiqueta = static_cast<uint32_t>(tabla.offsets.size() - 1);
+			tabla.caracteres.append(texto.data(), texto.size());
+			tabla.offsets.push_back(static_cast<uint32_t>(tabla.caracteres.size()));
+			tabla.verticeDeEtiqueta.push_back(-1);
+			tabla.indice.emplace(std::hash<std::string_view>()(texto), etiqueta);
+		}
+		return etiqueta;
+	}
+
+	/*
+	 * Saca a @vertice de la lista de los que tienen @etiqueta. Si era la cola, el indice inverso pasa al anterior
+	 */
+	static void DesenlazarEtiqueta(TablaEtiquetas& tabla, int vertice, uint32_t etiqueta) {
+		int anterior = tabla.anteriorConEtiqueta[vertice];
+		int siguiente = tabla.siguienteConEtiqueta[vertice];
+		if (anterior != -1) {
+			tabla.siguienteConEtiqueta[anterior] = siguiente;
+		}
+		if (siguiente != -1) {
+			tabla.anteriorConEtiqueta[siguiente] = anterior;
+		}
+		else {
+			tabla.verticeDeEtiqueta[etiqueta] = anterior;
+		}
+		tabla.anteriorConEtiqueta[vertice] = -1;
+		tabla.siguienteConEtiqueta[vertice] = -1;
+	}
+
+	/*
+	 * Da @texto como etiqueta a @vertice en O(1) (mas el hash de @texto). @vertice pasa a ser la cola de la lista
+	 * de su etiqueta nueva, asi que el indice inverso apunta al ultimo que la recibio de los que la conservan
+	 */
+	static void AsignarEtiqueta(TablaEtiquetas& tabla, int cantidadVertices, int vertice, std::string_view texto) {
+		if (tabla.etiquetaDeVertice.empty()) {
+			tabla.etiquetaDeVertice.assign(cantidadVertices, SIN_ETIQUETA);
+			tabla.anteriorConEtiqueta.assign(cantidadVertices, -1);
+			tabla.siguienteConEtiqueta.assign(cantidadVertices, -1);
+		}
+		uint32_t anterior = tabla.etiquetaDeVertice[vertice];
+		if (anterior != SIN_ETIQUETA) {
+			DesenlazarEtiqueta(tabla, vertice, anterior);
+		}
+		uint32_t etiqueta = InternarEtiqueta(tabla, texto);
+		tabla.etiquetaDeVertice[vertice] = etiqueta;
+		int cola = tabla.verticeDeEtiqueta[etiqueta];
+		tabla.anteriorConEtiqueta[vertice] = cola;
+		if (cola != -1) {
+			tabla.siguienteConEtiqueta[cola] = vertice;
+		}
+		tabla.verticeDeEtiqueta[etiqueta] = vertice;
+	}
+
+	static std::string_view EtiquetaDeVertice(const TablaEtiquetas& tabla, int vertice) {
+		if (tabla.etiquetaDeVertice.empty() || tabla.etiquetaDeVertice[vertice] == SIN_ETIQUETA) {
+			return std::string_view();
+		}
+		return VerEtiqueta(tabla, tabla.etiquetaDeVertice[vertice]);
+	}
+
+	static int VerticeDeEtiqueta(const TablaEtiquetas& tabla, std::string_view texto) {
+		uint32_t etiqueta = BuscarEtiqueta(tabla, texto);
+		return etiqueta == SIN_ETIQUETA ? -1 : tabla.verticeDeEtiqueta[etiqueta];
+	}
+
+	// Fila de la lista de adyacencia. Toma la memoria del recurso del grafo
+	typedef std::pmr::vector<int> FilaAdyacencia;
+
+	static std::pmr::memory_resource* RecursoOPorDefecto(std::pmr::memory_resource* recurso) {
+		return recurso != nullptr ? recurso : std::pmr::get_default_resource();
+	}
+
 	struct Grafo {
+		// Las filas de listaAdyacencia y la matriz de bits se piden a @recurso
+		explicit Grafo(std::pmr::memory_resource* recurso)
+			: listaAdyacencia(recurso), matrizAdyacencia(recurso) {
+		}
+
 		string id;
 		string nombre;
 		int cantidadVertices = 0;
-		vector<list<int>> listaAdyacencia;
+		std::pmr::vector<FilaAdyacencia> listaAdyacencia;
 		TipoGrafo tipo = DIRIGIDO;
+		ModoAdyacencia modo = INSERCION;
+		long long entradasAdyacencia = 0;   // Cantidad total de elementos en listaAdyacencia
+		long long entradasLazo = 0;         // Cuantas de esas entradas son lazos (un vertice en su propia lista)
+		// Matriz de adyacencia en bits (fila por vertice). Vacia hasta que el grafo se vuelve denso;
+		// a partir de ahi se mantiene en paralelo a listaAdyacencia para responder SonAdyacentes en O(1)
+		std::pmr::vector<uint64_t> matrizAdyacencia;
+		size_t palabrasPorFila = 0;
+		// Estadisticas mantenidas por Conectar (y recalculadas por las operaciones en bloque)
+		long long cantidadAristas = 0;           // Aristas guardadas, contando lazos y repetidas
+		long long cantidadLazos = 0;
+		long long cantidadAristasRepetidas = 0;  // Aristas entre vertices que ya eran adyacentes
+		vector<int> gradoSimple;                 // Vecinos distintos de cada vertice sin contar lazos
+		vector<int> histogramaGrados;            // histogramaGrados[g] = cantidad de vertices con gradoSimple g
+		long long sumaGradosSimples = 0;
+		int gradoSimpleMaximo = 0;
+		// Conectar en modo INSERCION sin matriz no averigua si la arista ya existia (seria lineal en el grado), y
+		// ConectarLote no recorre todo el grafo: los dos dejan gradoSimple, el histograma, sumaGradosSimples,
+		// gradoSimpleMaximo y cantidadAristasRepetidas pendientes y la primera consulta que los necesita los recalcula
+		// (ver ActualizarEstadisticas). entradasAdyacencia, entradasLazo, cantidadAristas y cantidadLazos siempre estan al dia
+		std::atomic<bool> estadisticasPendientes{ false };
+		std::mutex mutexEstadisticas;
+		TablaEtiquetas etiquetas;
+	};
+
+	// La matriz se activa cuando entradas / V^2 >= 1 / DIVISOR_DENSIDAD_MATRIZ. A esa densidad la matriz
+	// (V^2 / 8 bytes) ocupa menos que los nodos de lista que ya tiene el grafo
+	const long long DIVISOR_DENSIDAD_MATRIZ = 64;
+
+	static int ContarBits(uint64_t palabra) {
+#ifdef _MSC_VER
+		return static_cast<int>(__popcnt64(palabra));
+#else
+		return __builtin_popcountll(palabra);
+#endif
+	}
+
+	static int PosicionPrimerBit(uint64_t palabra) {
+#ifdef _MSC_VER
+		unsigned long posicion;
+		_BitScanForward64(&posicion, palabra);
+		return static_cast<int>(posicion);
+#else
+		return __builtin_ctzll(palabra);
+#endif
+	}
+
+	static const uint64_t* ObtenerFilaMatriz(const Grafo* grafo, int vertice) {
+		return grafo->matrizAdyacencia.data() + vertice * grafo->palabrasPorFila;
+	}
+
+	static bool ObtenerBit(const uint64_t* fila, int vertice) {
+		return (fila[vertice >> 6] >> (vertice & 63)) & 1;
+	}
+
+	/*
+	 * Bits validos de la palabra @indicePalabra de una fila: todos salvo los que exceden a cantidadVertices en la ultima palabra
+	 */
+	static uint64_t MascaraPalabra(const Grafo* grafo, size_t indicePalabra) {
+		int bitsRestantes = grafo->cantidadVertices - static_cast<int>(indicePalabra * 64);
+		return bitsRestantes >= 64 ? ~uint64_t(0) : (uint64_t(1) << bitsRestantes) - 1;
+	}
+
+	static void MarcarBit(Grafo* grafo, int verticeOrigen, int verticeDestino) {
+		grafo->matrizAdyacencia[verticeOrigen * grafo->palabrasPorFila + (verticeDestino >> 6)] |= uint64_t(1) << (verticeDestino & 63);
+	}
+
+	/*
+	 * Construye la matriz de bits a partir de listaAdyacencia. Desde este momento AgregarEntrada la mantiene actualizada
+	 */
+	static void ActivarMatriz(Grafo* grafo) {
+		grafo->palabrasPorFila = (grafo->cantidadVertices + 63) / 64;
+		grafo->matrizAdyacencia.assign(grafo->palabrasPorFila * grafo->cantidadVertices, 0);
+		for (int verticeOrigen = 0; verticeOrigen < grafo->cantidadVertices; ++verticeOrigen) {
+			for (int verticeDestino : grafo->listaAdyacencia[verticeOrigen]) {
+				MarcarBit(grafo, verticeOrigen, verticeDestino);
+			}
+		}
+	}
+
+	static void VerificarDensidad(Grafo* grafo) {
+		long long cantidadVertices = grafo->cantidadVertices;
+		if (grafo->matrizAdyacencia.empty() && cantidadVertices > 0 &&
+			grafo->entradasAdyacencia * DIVISOR_DENSIDAD_MATRIZ >= cantidadVertices * cantidadVertices) {
+			ActivarMatriz(grafo);
+		}
+	}
+
+	/*
+	 * Suma un vecino distinto a @vertice, moviendolo en el histograma de grados
+	 */
+	static void RegistrarVecinoNuevo(Grafo* grafo, int vertice) {
+		grafo->histogramaGrados[grafo->gradoSimple[vertice]]--;
+		grafo->gradoSimple[vertice]++;
+		grafo->histogramaGrados[grafo->gradoSimple[vertice]]++;
+		grafo->sumaGradosSimples++;
+		grafo->gradoSimpleMaximo = std::max(grafo->gradoSimpleMaximo, grafo->gradoSimple[vertice]);
+	}
+
+	/*
+	 * Deriva cantidadAristas y cantidadLazos de entradasAdyacencia y entradasLazo
+	 */
+	static void ContarAristas(Grafo* grafo) {
+		long long entradasSinLazo = grafo->entradasAdyacencia - grafo->entradasLazo;
+		if (grafo->tipo == DIRIGIDO) {
+			grafo->cantidadLazos = grafo->entradasLazo;
+			grafo->cantidadAristas = grafo->entradasAdyacencia;
+		}
+		else {
+			// En INSERCION un lazo no dirigido ocupa dos lugares en la lista de su vertice; en ORDENADA uno solo
+			grafo->cantidadLazos = grafo->modo == ORDENADA ? grafo->entradasLazo : grafo->entradasLazo / 2;
+			grafo->cantidadAristas = entradasSinLazo / 2 + grafo->cantidadLazos;
+		}
+	}
+
+	/*
+	 * Estadisticas de un grafo calculadas desde sus listas, sin tocar el grafo
+	 */
+	struct EstadisticasGrados {
+		long long entradasAdyacencia = 0;
+		long long entradasLazo = 0;
+		vector<int> gradoSimple;
+		vector<int> histogramaGrados;
+		long long sumaGradosSimples = 0;
+		int gradoSimpleMaximo = 0;
+		long long cantidadAristasRepetidas = 0;
 	};
+
+	/*
+	 * Recorre las listas de @grafo en O(V + E) y devuelve sus entradas, grados simples y aristas repetidas
+	 */
+	static EstadisticasGrados CalcularGrados(const Grafo* grafo) {
+		int cantidadVertices = grafo->cantidadVertices;
+		EstadisticasGrados estadisticas;
+		estadisticas.gradoSimple.assign(cantidadVertices, 0);
+		estadisticas.histogramaGrados.assign(cantidadVertices + 1, 0);
+
+		vector<int> marcas(cantidadVertices, -1);
+		for (int vertice = 0; vertice < cantidadVertices; ++vertice) {
+			for (int vecino : grafo->listaAdyacencia[vertice]) {
+				if (vecino == vertice) {
+					estadisticas.entradasLazo++;
+				}
+				else if (marcas[vecino] != vertice) {
+					marcas[vecino] = vertice;
+					estadisticas.gradoSimple[vertice]++;
+				}
+			}
+			estadisticas.entradasAdyacencia += grafo->listaAdyacencia[vertice].size();
+			estadisticas.histogramaGrados[estadisticas.gradoSimple[vertice]]++;
+			estadisticas.sumaGradosSimples += estadisticas.gradoSimple[vertice];
+			estadisticas.gradoSimpleMaximo = std::max(estadisticas.gradoSimpleMaximo, estadisticas.gradoSimple[vertice]);
+		}
+
+		long long entradasSinLazo = estadisticas.entradasAdyacencia - estadisticas.entradasLazo;
+		estadisticas.cantidadAristasRepetidas = grafo->tipo == DIRIGIDO
+			? entradasSinLazo - estadisticas.sumaGradosSimples
+			: (entradasSinLazo - estadisticas.sumaGradosSimples) / 2;
+		return estadisticas;
+	}
+
+	/*
+	 * Pasa a @grafo los grados y las repetidas de @estadisticas y marca que ya no estan pendientes
+	 */
+	static void PublicarGrados(Grafo* grafo, EstadisticasGrados& estadisticas) {
+		grafo->gradoSimple = std::move(estadisticas.gradoSimple);
+		grafo->histogramaGrados = std::move(estadisticas.histogramaGrados);
+		grafo->sumaGradosSimples = estadisticas.sumaGradosSimples;
+		grafo->gradoSimpleMaximo = estadisticas.gradoSimpleMaximo;
+		grafo->cantidadAristasRepetidas = estadisticas.cantidadAristasRepetidas;
+		grafo->estadisticasPendientes.store(false, std::memory_order_release);
+	}
+
+	/*
+	 * Recalcula desde las listas todas las estadisticas del grafo en O(V + E).
+	 * Lo usan las operaciones que cargan muchas aristas sin pasar por Conectar
+	 */
+	static void RecalcularEstadisticas(Grafo* grafo) {
+		EstadisticasGrados estadisticas = CalcularGrados(grafo);
+		grafo->entradasAdyacencia = estadisticas.entradasAdyacencia;
+		grafo->entradasLazo = estadisticas.entradasLazo;
+		ContarAristas(grafo);
+		PublicarGrados(grafo, estadisticas);
+	}
+
+	/*
+	 * Recalcula las estadisticas de grados y repetidas si Conectar o ConectarLote las dejaron pendientes. Las consultas
+	 * la llaman antes de leerlas; como puede llamarse desde varios hilos a la vez (por ejemplo desde ParaCadaArista
+	 * por rangos) el recalculo se hace una sola vez, bajo el mutex del grafo. Solo escribe los campos pendientes:
+	 * entradasAdyacencia, entradasLazo, cantidadAristas y cantidadLazos ya estan al dia y otras consultas los leen
+	 * sin tomar el mutex
+	 */
+	static void ActualizarEstadisticas(const Grafo* grafo) {
+		if (!grafo->estadisticasPendientes.load(std::memory_order_acquire)) {
+			return;
+		}
+		Grafo* modificable = const_cast<Grafo*>(grafo);
+		std::lock_guard<std::mutex> bloqueo(modificable->mutexEstadisticas);
+		if (grafo->estadisticasPendientes.load(std::memory_order_relaxed)) {
+			EstadisticasGrados estadisticas = CalcularGrados(grafo);
+			PublicarGrados(modificable, estadisticas);
+		}
+	}
+
+	/*
+	 * Agrega @verticeDestino a la lista de @verticeOrigen manteniendo el contador y la matriz (si esta activa).
+	 * En modo ORDENADA inserta en su posicion y no agrega repetidos. Devuelve false si no agrego nada
+	 */
+	static bool AgregarEntrada(Grafo* grafo, int verticeOrigen, int verticeDestino) {
+		FilaAdyacencia& vecinos = grafo->listaAdyacencia[verticeOrigen];
+		if (grafo->modo == ORDENADA) {
+			auto posicion = std::lower_bound(vecinos.begin(), vecinos.end(), verticeDestino);
+			if (posicion != vecinos.end() && *posicion == verticeDestino) {
+				return false;
+			}
+			vecinos.insert(posicion, verticeDestino);
+		}
+		else {
+			vecinos.push_back(verticeDestino);
+		}
+		grafo->entradasAdyacencia++;
+		if (verticeOrigen == verticeDestino) {
+			grafo->entradasLazo++;
+		}
+		if (!grafo->matrizAdyacencia.empty()) {
+			MarcarBit(grafo, verticeOrigen, verticeDestino);
+		}
+		return true;
+	}
+
 	/*
 	* Precondicion: -
 	* Postcondicion: Si @cantidad de vertices es un numero mayor o igual que cero
 	* devuelve un grafo dirigido de nombre @nombre al cual se le asocia un identificador unico.
 	* Si @cantidad de vertices es menor que cero devueleve NULL
+	* Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso (por ejemplo una arena monotona), que debe vivir mas que el grafo.
+	* El grafo solo pide memoria a @recurso desde un hilo a la vez, asi que no hace falta que sea seguro entre hilos
 	*/
-	Grafo* CrearGrafoDirigido(string nombre, int cantidadVertices) {
+	Grafo* CrearGrafoDirigido(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso) {
 		if (cantidadVertices < 0) {
 			return nullptr;
 		}
 		else {
-			Grafo* grafo = new Grafo;
-			grafo->nombre = nombre;
+			Grafo* grafo = new Grafo(RecursoOPorDefecto(recurso));
+			grafo->nombre = std::move(nombre);
 			grafo->id = GenerarIdentificadorUnico();
 			grafo->tipo = DIRIGIDO;
 			grafo->listaAdyacencia.resize(cantidadVertices);
 			grafo->cantidadVertices = cantidadVertices;
+			RecalcularEstadisticas(grafo);
 			return grafo;
 		}
 	}
@@ -45,18 +407,21 @@ namespace URGGrafo {
 	* Postcondicion: Si @cantidad de vertices es un numero mayor o igual que cero
 	* devuelve un grafo no dirigido de nombre @nombre al cual se le asocia un identificador unico.
 	* Si @cantidad de vertices es menor que cero devuelve NULL
+	* Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso (por ejemplo una arena monotona), que debe vivir mas que el grafo.
+	* El grafo solo pide memoria a @recurso desde un hilo a la vez, asi que no hace falta que sea seguro entre hilos
 	*/
-	Grafo* CrearGrafoNoDirigido(string nombre, int cantidadVertices) {
+	Grafo* CrearGrafoNoDirigido(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso) {
 		if (cantidadVertices < 0) {
 			return nullptr;
 		}
 		else {
-			Grafo* grafo = new Grafo;
-			grafo->nombre = nombre;
+			Grafo* grafo = new Grafo(RecursoOPorDefecto(recurso));
+			grafo->nombre = std::move(nombre);
 			grafo->id = GenerarIdentificadorUnico();
 			grafo->tipo = NODIRIGIDO;
 			grafo->listaAdyacencia.resize(cantidadVertices);
 			grafo->cantidadVertices = cantidadVertices;
+			RecalcularEstadisticas(grafo);
 			return grafo;
 		}
 	}
@@ -77,23 +442,346 @@ namespace URGGrafo {
 		return grafo->id;
 	}
 
+	/*
+	* Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al cambiar el nombre o destruir @grafo
+	*/
+	std::string_view VerNombre(const Grafo* grafo) {
+		return grafo->nombre;
+	}
+
+	/*
+	* Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	*/
+	std::string_view VerIdentificador(const Grafo* grafo) {
+		return grafo->id;
+	}
+
 	/*
 	* Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	* Postcondicion: Si @grafo es un grafo no dirigido, se agrega una relacion de adyacencia conmutativa entre @verticeOrigen y @verticeDestino (@verticeOrigen es adyacente a @verticeDestino y viceversa).
 	* Si @grafo es un grafo dirigido, se agrega una relacion de adyacencia de @verticeOrigen y @verticeDestino (@verticeOrigen es adyacente a @vertice destino)
 	* Si @verticeOrigen o @verticeDestino no pertenece al grafo no realiza ninguna accion
+	* Si @grafo esta en modo ORDENADA y la adyacencia ya existia no realiza ninguna accion
+	* En modo INSERCION sin matriz de bits es O(1): los grados simples y las aristas repetidas se recalculan en O(V + E)
+	* en la siguiente consulta que los necesite (EsCompleto, ObtenerSucesionGrafica, ObtenerHistogramaGrados, ObtenerCantidadAristasRepetidas)
 	*/
 	void Conectar(Grafo* grafo, int verticeOrigen, int verticeDestino) {
 		if (verticeOrigen >= 0 && verticeDestino >= 0 &&
 			verticeOrigen < grafo->cantidadVertices && verticeDestino < grafo->cantidadVertices) {
-			if (grafo->tipo == DIRIGIDO) {
-				grafo->listaAdyacencia[verticeOrigen].push_back(verticeDestino);
+			// Saber si la adyacencia ya existia solo es barato con la matriz o con la fila ordenada. Si no, las
+			// estadisticas de grados quedan pendientes y Conectar sigue siendo O(1)
+			bool pertenenciaBarata = grafo->modo == ORDENADA || !grafo->matrizAdyacencia.empty();
+			bool existia = pertenenciaBarata && verticeOrigen != verticeDestino && SonAdyacentes(grafo, verticeOrigen, verticeDestino);
+			if (!AgregarEntrada(grafo, verticeOrigen, verticeDestino)) {
+				return;
+			}
+			if (grafo->tipo == NODIRIGIDO) {
+				AgregarEntrada(grafo, verticeDestino, verticeOrigen);
+			}
+
+			grafo->cantidadAristas++;
+			if (verticeOrigen == verticeDestino) {
+				grafo->cantidadLazos++;
+			}
+			else if (!pertenenciaBarata || grafo->estadisticasPendientes.load(std::memory_order_relaxed)) {
+				grafo->estadisticasPendientes.store(true, std::memory_order_relaxed);
+			}
+			else if (existia) {
+				grafo->cantidadAristasRepetidas++;
 			}
 			else {
-				grafo->listaAdyacencia[verticeOrigen].push_back(verticeDestino);
-				grafo->listaAdyacencia[verticeDestino].push_back(verticeOrigen);
+				RegistrarVecinoNuevo(grafo, verticeOrigen);
+				if (grafo->tipo == NODIRIGIDO) {
+					RegistrarVecinoNuevo(grafo, verticeDestino);
+				}
+			}
+			VerificarDensidad(grafo);
+		}
+	}
+
+	/*
+	 * Ejecuta @funcion(limites[i], limites[i + 1]) para cada rango consecutivo de @limites, un hilo por rango.
+	 * Con un solo rango no lanza hilos
+	 */
+	template <typename Limite, typename Funcion>
+	static void EjecutarPorRangos(const vector<Limite>& limites, Funcion funcion) {
+		if (limites.size() <= 2) {
+			funcion(limites.front(), limites.back());
+			return;
+		}
+		vector<std::thread> trabajadores;
+		for (size_t i = 0; i + 1 < limites.size(); ++i) {
+			trabajadores.emplace_back(funcion, limites[i], limites[i + 1]);
+		}
+		for (std::thread& trabajador : trabajadores) {
+			trabajador.join();
+		}
+	}
+
+	/*
+	 * Divide [0, @cantidad) en @partes rangos de igual tamanio (o menos si no alcanza). Devuelve los limites
+	 */
+	static vector<int> DividirEnRangos(int cantidad, unsigned int partes) {
+		partes = std::max(1u, std::min(partes, static_cast<unsigned int>(std::max(cantidad, 1))));
+		vector<int> limites;
+		for (unsigned int i = 0; i <= partes; ++i) {
+			limites.push_back(static_cast<int>(static_cast<long long>(cantidad) * i / partes));
+		}
+		return limites;
+	}
+
+	static unsigned int HilosDisponibles() {
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	/*
+	 * Devuelve @hilos si las filas de @grafo pueden pedir memoria desde varios hilos a la vez y 1 si no. Solo
+	 * new_delete_resource es seguro entre hilos; una arena monotona o un pool sin sincronizar no lo son
+	 */
+	static unsigned int HilosParaFilas(const Grafo* grafo, unsigned int hilos) {
+		return grafo->listaAdyacencia.get_allocator().resource()->is_equal(*std::pmr::new_delete_resource()) ? hilos : 1;
+	}
+
+	// Por debajo de esta cantidad de aristas ConectarLote carga en un solo hilo: lanzar hilos cuesta mas que la carga
+	const size_t MINIMO_ARISTAS_LOTE_PARALELO = 1 << 16;
+
+	// ConectarLote cuenta en 32 bits las entradas de cada trozo por vertice: un lote mas grande se carga en tandas
+	const size_t MAXIMO_ARISTAS_TANDA = UINT32_MAX / 2;
+
+	// Un lote con menos de V / DIVISOR_LOTE_COMPACTO aristas indexa sus arreglos auxiliares por vertice tocado
+	const size_t DIVISOR_LOTE_COMPACTO = 8;
+
+	// A partir de esta cantidad de vertices las filas del complemento se calculan en varios hilos
+	const int MINIMO_VERTICES_COMPLEMENTO_PARALELO = 2048;
+
+	/*
+	* Quita los repetidos de @vecinos conservando la primera aparicion de cada vertice.
+	* @marcas tiene un lugar por vertice del grafo y se reutiliza entre filas usando @fila como sello
+	*/
+	static void QuitarRepetidos(FilaAdyacencia& vecinos, vector<int>& marcas, int fila) {
+		size_t destino = 0;
+		for (size_t i = 0; i < vecinos.size(); ++i) {
+			if (marcas[vecinos[i]] != fila) {
+				marcas[vecinos[i]] = fila;
+				vecinos[destino++] = vecinos[i];
+			}
+		}
+		vecinos.resize(destino);
+	}
+
+	/*
+	 * Igual que QuitarRepetidos pero sin memoria de V: busca cada vecino en una copia ordenada y sin repetidos de la
+	 * fila (@ordenados, reusable entre filas). O(d log d) para d vecinos
+	 */
+	static void QuitarRepetidosFila(FilaAdyacencia& vecinos, vector<int>& ordenados) {
+		ordenados.assign(vecinos.begin(), vecinos.end());
+		std::sort(ordenados.begin(), ordenados.end());
+		ordenados.erase(std::unique(ordenados.begin(), ordenados.end()), ordenados.end());
+		if (ordenados.size() == vecinos.size()) {
+			return;
+		}
+		vector<bool> vistos(ordenados.size(), false);
+		size_t destino = 0;
+		for (size_t i = 0; i < vecinos.size(); ++i) {
+			size_t posicion = std::lower_bound(ordenados.begin(), ordenados.end(), vecinos[i]) - ordenados.begin();
+			if (!vistos[posicion]) {
+				vistos[posicion] = true;
+				vecinos[destino++] = vecinos[i];
+			}
+		}
+		vecinos.resize(destino);
+	}
+
+	/*
+	* Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales.
+	* @aristas apunta a @cantidadAristas pares (origen, destino)
+	* Postcondicion: Equivale a llamar a Conectar con cada par de @aristas en orden, pero reserva de una vez
+	* el espacio exacto de cada vertice y llena las listas en paralelo por trozos de @aristas, recorriendo cada arista una sola vez.
+	* Los pares con algun vertice fuera del grafo se ignoran.
+	* Si @deduplicar es true (o @grafo esta en modo ORDENADA) no quedan adyacencias repetidas, incluidas las que ya existian
+	* Un lote chico frente al grafo no recorre sus V vertices. Como en Conectar, los grados simples y las aristas repetidas
+	* se recalculan en la siguiente consulta que los necesite
+	*/
+	void ConectarLote(Grafo* grafo, const std::pair<int, int>* aristas, size_t cantidadAristas, bool deduplicar) {
+		if (!grafo || cantidadAristas == 0) {
+			return;
+		}
+		if (cantidadAristas > MAXIMO_ARISTAS_TANDA) {
+			// Tandas consecutivas: las filas reciben los vecinos en el mismo orden que con un solo lote
+			for (size_t inicio = 0; inicio < cantidadAristas; inicio += MAXIMO_ARISTAS_TANDA) {
+				ConectarLote(grafo, aristas + inicio, std::min(MAXIMO_ARISTAS_TANDA, cantidadAristas - inicio), deduplicar);
+			}
+			return;
+		}
+		int cantidadVertices = grafo->cantidadVertices;
+		bool noDirigido = grafo->tipo == NODIRIGIDO;
+		auto esValida = [cantidadVertices](const std::pair<int, int>& arista) {
+			return arista.first >= 0 && arista.second >= 0 && arista.first < cantidadVertices && arista.second < cantidadVertices;
+		};
+
+		// Un lote chico frente a V indexa sus arreglos por la posicion de cada vertice en @tocados (los que cambian de
+		// fila, ordenados) en lugar de por vertice: asi cuesta O(lote log lote) y no O(V) sin importar el tamanio del grafo
+		bool compacto = cantidadAristas < static_cast<size_t>(cantidadVertices) / DIVISOR_LOTE_COMPACTO;
+		vector<int> tocados;
+		if (compacto) {
+			for (size_t i = 0; i < cantidadAristas; ++i) {
+				if (esValida(aristas[i])) {
+					tocados.push_back(aristas[i].first);
+					if (noDirigido) {
+						tocados.push_back(aristas[i].second);
+					}
+				}
+			}
+			std::sort(tocados.begin(), tocados.end());
+			tocados.erase(std::unique(tocados.begin(), tocados.end()), tocados.end());
+		}
+		int cantidadIndices = compacto ? static_cast<int>(tocados.size()) : cantidadVertices;
+		auto indice = [&](int vertice) {
+			return compacto ? static_cast<int>(std::lower_bound(tocados.begin(), tocados.end(), vertice) - tocados.begin()) : vertice;
+		};
+		auto verticeDeIndice = [&](int posicion) {
+			return compacto ? tocados[posicion] : posicion;
+		};
+
+		// @aristas se parte en trozos consecutivos, uno por hilo. Un lote chico se carga en este hilo
+		unsigned int hilos = 1;
+		if (cantidadAristas >= MINIMO_ARISTAS_LOTE_PARALELO) {
+			hilos = HilosDisponibles();
+		}
+		vector<size_t> limitesTrozos;
+		vector<int> trozos;
+		for (unsigned int i = 0; i <= hilos; ++i) {
+			limitesTrozos.push_back(cantidadAristas * i / hilos);
+			trozos.push_back(static_cast<int>(i));
+		}
+
+		// Primera pasada, un hilo por trozo: cuantas entradas aporta cada trozo a cada vertice
+		vector<vector<uint32_t>> posiciones(hilos);
+		EjecutarPorRangos(trozos, [&](int trozo, int) {
+			vector<uint32_t>& entradasTrozo = posiciones[trozo];
+			entradasTrozo.assign(cantidadIndices, 0);
+			for (size_t i = limitesTrozos[trozo]; i < limitesTrozos[trozo + 1]; ++i) {
+				if (esValida(aristas[i])) {
+					entradasTrozo[indice(aristas[i].first)]++;
+					if (noDirigido) {
+						entradasTrozo[indice(aristas[i].second)]++;
+					}
+				}
+			}
+		});
+
+		// En este hilo cada fila crece una sola vez hasta su tamanio final: las filas toman memoria del recurso del
+		// grafo, que puede no admitir hilos. La cuenta de cada trozo pasa a ser la posicion donde el trozo escribe su
+		// primer vecino, contada desde el final anterior de la fila, asi los trozos quedan en el orden de @aristas
+		vector<size_t> inicioNuevas(cantidadIndices, 0);
+		vector<size_t> entradasNuevas(cantidadIndices, 0);
+		size_t totalEntradas = 0;
+		for (int posicionVertice = 0; posicionVertice < cantidadIndices; ++posicionVertice) {
+			uint32_t posicion = 0;
+			for (vector<uint32_t>& entradasTrozo : posiciones) {
+				uint32_t entradas = entradasTrozo[posicionVertice];
+				entradasTrozo[posicionVertice] = posicion;
+				posicion += entradas;
+			}
+			if (posicion > 0) {
+				FilaAdyacencia& vecinos = grafo->listaAdyacencia[verticeDeIndice(posicionVertice)];
+				inicioNuevas[posicionVertice] = vecinos.size();
+				vecinos.resize(vecinos.size() + posicion);
+			}
+			entradasNuevas[posicionVertice] = posicion;
+			totalEntradas += posicion;
+		}
+		if (totalEntradas == 0) {
+			return;
+		}
+
+		// Segunda pasada, un hilo por trozo: cada trozo escribe solo sus aristas en lugares ya reservados y distintos
+		EjecutarPorRangos(trozos, [&](int trozo, int) {
+			vector<uint32_t>& siguiente = posiciones[trozo];
+			for (size_t i = limitesTrozos[trozo]; i < limitesTrozos[trozo + 1]; ++i) {
+				const std::pair<int, int>& arista = aristas[i];
+				if (!esValida(arista)) {
+					continue;
+				}
+				int origen = indice(arista.first);
+				grafo->listaAdyacencia[arista.first][inicioNuevas[origen] + siguiente[origen]++] = arista.second;
+				if (noDirigido) {
+					int destino = indice(arista.second);
+					grafo->listaAdyacencia[arista.second][inicioNuevas[destino] + siguiente[destino]++] = arista.first;
+				}
+			}
+		});
+		posiciones.clear();
+
+		// Rangos de vertices con una cantidad de entradas parecida para cada hilo
+		vector<int> limites(1, 0);
+		size_t acumulado = 0;
+		for (int posicionVertice = 0; posicionVertice < cantidadIndices; ++posicionVertice) {
+			acumulado += entradasNuevas[posicionVertice];
+			if (acumulado * hilos >= totalEntradas * limites.size() && limites.size() < hilos) {
+				limites.push_back(posicionVertice + 1);
 			}
 		}
+		limites.push_back(cantidadIndices);
+
+		bool quitarRepetidos = deduplicar || grafo->modo == ORDENADA;
+		bool matrizActiva = !grafo->matrizAdyacencia.empty();
+		std::atomic<long long> cambioEntradas{ 0 };
+		std::atomic<long long> cambioEntradasLazo{ 0 };
+
+		// Tercera pasada por rangos de vertices: orden, repetidos y matriz de las filas que cambiaron. Solo achica
+		// filas, asi que no pide memoria al recurso del grafo. Tambien cuenta cuanto cambiaron las entradas y los
+		// lazos, para actualizar los contadores de aristas sin recorrer el grafo entero
+		auto terminarRango = [&](int desde, int hasta) {
+			vector<int> marcas;
+			vector<int> ordenados;
+			if (quitarRepetidos && grafo->modo != ORDENADA && !compacto) {
+				marcas.assign(grafo->cantidadVertices, -1);
+			}
+			long long entradas = 0;
+			long long entradasLazo = 0;
+			for (int posicionVertice = desde; posicionVertice < hasta; ++posicionVertice) {
+				if (entradasNuevas[posicionVertice] == 0) {
+					continue;
+				}
+				int vertice = verticeDeIndice(posicionVertice);
+				FilaAdyacencia& vecinos = grafo->listaAdyacencia[vertice];
+				size_t inicio = inicioNuevas[posicionVertice];
+				if (quitarRepetidos) {
+					entradasLazo -= std::count(vecinos.begin(), vecinos.begin() + inicio, vertice);
+				}
+				if (grafo->modo == ORDENADA) {
+					std::sort(vecinos.begin(), vecinos.end());
+					vecinos.erase(std::unique(vecinos.begin(), vecinos.end()), vecinos.end());
+				}
+				else if (quitarRepetidos && compacto) {
+					QuitarRepetidosFila(vecinos, ordenados);
+				}
+				else if (quitarRepetidos) {
+					QuitarRepetidos(vecinos, marcas, vertice);
+				}
+				entradas += static_cast<long long>(vecinos.size()) - static_cast<long long>(inicio);
+				entradasLazo += std::count(quitarRepetidos ? vecinos.begin() : vecinos.begin() + inicio, vecinos.end(), vertice);
+				if (matrizActiva) {
+					for (int vecino : vecinos) {
+						MarcarBit(grafo, vertice, vecino);
+					}
+				}
+			}
+			cambioEntradas += entradas;
+			cambioEntradasLazo += entradasLazo;
+		};
+
+		EjecutarPorRangos(limites, terminarRango);
+
+		// Los contadores de aristas quedan exactos; los grados y las repetidas se recalculan en la siguiente consulta
+		grafo->entradasAdyacencia += cambioEntradas.load();
+		grafo->entradasLazo += cambioEntradasLazo.load();
+		ContarAristas(grafo);
+		grafo->estadisticasPendientes.store(true, std::memory_order_relaxed);
+		VerificarDensidad(grafo);
 	}
 
 	/*
@@ -103,6 +791,13 @@ namespace URGGrafo {
 	bool SonAdyacentes(const Grafo* grafo, int verticeOrigen, int verticeDestino) {
 		if (verticeOrigen >= 0 && verticeOrigen < grafo->cantidadVertices &&
 			verticeDestino >= 0 && verticeDestino < grafo->cantidadVertices) {
+			if (!grafo->matrizAdyacencia.empty()) {
+				return ObtenerBit(ObtenerFilaMatriz(grafo, verticeOrigen), verticeDestino);
+			}
+			if (grafo->modo == ORDENADA) {
+				const FilaAdyacencia& vecinos = grafo->listaAdyacencia[verticeOrigen];
+				return std::binary_search(vecinos.begin(), vecinos.end(), verticeDestino);
+			}
 			for (int vertice : grafo->listaAdyacencia[verticeOrigen]) {
 				if (vertice == verticeDestino) {
 					return true;
@@ -112,6 +807,74 @@ namespace URGGrafo {
 		return false;
 	}
 
+	/*
+	 * Agrega "@verticeOrigen-@verticeDestino " al final de @resultado sin pasar por strings temporales
+	 */
+	static void AgregarArista(string& resultado, int verticeOrigen, int verticeDestino) {
+		char numero[std::numeric_limits<int>::digits10 + 2];
+		resultado.append(numero, std::to_chars(numero, numero + sizeof(numero), verticeOrigen).ptr);
+		resultado += '-';
+		resultado.append(numero, std::to_chars(numero, numero + sizeof(numero), verticeDestino).ptr);
+		resultado += ' ';
+	}
+
+	/*
+	 * Recorre las aristas de @grafo con origen en [@verticeDesde, @verticeHasta), en orden de vertice origen y,
+	 * dentro de cada uno, en el orden de su lista.
+	 * En los no dirigidos cada arista esta en la lista de sus dos extremos y se toma la copia con origen <= destino.
+	 * Solo si hay lazos o repetidos en modo INSERCION se descartan los vecinos ya vistos de cada fila, buscandolos en
+	 * una copia ordenada de la fila: O(d log d) por fila y memoria de la fila mas larga, no de V, asi un rango chico
+	 * cuesta lo mismo que sus filas
+	 */
+	template <typename Funcion>
+	static void RecorrerAristas(const Grafo* grafo, int verticeDesde, int verticeHasta, Funcion&& funcion) {
+		if (grafo->tipo == DIRIGIDO) {
+			for (int vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+				for (int vecino : grafo->listaAdyacencia[vertice]) {
+					funcion(vertice, vecino);
+				}
+			}
+			return;
+		}
+
+		ActualizarEstadisticas(grafo);
+		if (grafo->modo == ORDENADA || (grafo->cantidadLazos == 0 && grafo->cantidadAristasRepetidas == 0)) {
+			for (int vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+				for (int vecino : grafo->listaAdyacencia[vertice]) {
+					if (vertice <= vecino) {
+						funcion(vertice, vecino);
+					}
+				}
+			}
+			return;
+		}
+
+		vector<int> ordenados;
+		vector<bool> vistos;
+		for (int vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+			const FilaAdyacencia& vecinos = grafo->listaAdyacencia[vertice];
+			ordenados.clear();
+			for (int vecino : vecinos) {
+				if (vertice <= vecino) {
+					ordenados.push_back(vecino);
+				}
+			}
+			std::sort(ordenados.begin(), ordenados.end());
+			ordenados.erase(std::unique(ordenados.begin(), ordenados.end()), ordenados.end());
+			vistos.assign(ordenados.size(), false);
+			for (int vecino : vecinos) {
+				if (vertice > vecino) {
+					continue;
+				}
+				size_t posicion = std::lower_bound(ordenados.begin(), ordenados.end(), vecino) - ordenados.begin();
+				if (!vistos[posicion]) {
+					vistos[posicion] = true;
+					funcion(vertice, vecino);
+				}
+			}
+		}
+	}
+
 	/*
 	* Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	* Postcondiciones: Devuelve los vertices en un registro en formato CSV donde cada campo es un vertice
@@ -148,21 +911,9 @@ namespace URGGrafo {
 		}
 
 		string resultado;
-		vector<vector<bool>> visitado(grafo->listaAdyacencia.size(), vector<bool>(grafo->listaAdyacencia.size(), false));
-
-		for (int i = 0; i < grafo->listaAdyacencia.size(); ++i) {
-			for (int vecino : grafo->listaAdyacencia[i]) {
-				if (grafo->tipo == DIRIGIDO) {
-					resultado += std::to_string(i) + "-" + std::to_string(vecino) + " ";
-				}
-				else {
-					if (!visitado[i][vecino]) {
-						resultado += std::to_string(i) + "-" + std::to_string(vecino) + " ";
-						visitado[i][vecino] = visitado[vecino][i] = true;
-					}
-				}
-			}
-		}
+		RecorrerAristas(grafo, 0, grafo->cantidadVertices, [&resultado](int verticeOrigen, int verticeDestino) {
+			AgregarArista(resultado, verticeOrigen, verticeDestino);
+		});
 
 		// Eliminar el espacio final si existe
 		if (!resultado.empty() && resultado.back() == ' ') {
@@ -173,100 +924,293 @@ namespace URGGrafo {
 	}
 
 	/*
- * Precondiciones:
+	* Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondiciones: Llama a @funcion con cada vertice de @grafo, de menor a mayor, junto con su etiqueta
+	* (vacia si no tiene) y @contexto. La etiqueta solo es valida durante la llamada
+	*/
+	void ParaCadaVertice(const Grafo* grafo, FuncionVertice funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		for (int vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			funcion(vertice, EtiquetaDeVertice(grafo->etiquetas, vertice), contexto);
+		}
+	}
+
+	/*
+	* Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondiciones: Llama a @funcion con cada arista de @grafo en el mismo orden que ObtenerAristas, sin armar texto.
+	* En los no dirigidos cada arista se informa una sola vez, con origen menor o igual que destino
+	*/
+	void ParaCadaArista(const Grafo* grafo, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		RecorrerAristas(grafo, 0, grafo->cantidadVertices, [funcion, contexto](int verticeOrigen, int verticeDestino) {
+			funcion(verticeOrigen, verticeDestino, contexto);
+		});
+	}
+
+	/*
+	* Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondiciones: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta).
+	* Recorrer rangos consecutivos da las mismas aristas en el mismo orden que recorrer todo el grafo, por lo que
+	* se pueden repartir rangos entre hilos
+	*/
+	void ParaCadaArista(const Grafo* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		verticeDesde = std::max(verticeDesde, 0);
+		verticeHasta = std::min(verticeHasta, grafo->cantidadVertices);
+		RecorrerAristas(grafo, verticeDesde, verticeHasta, [funcion, contexto](int verticeOrigen, int verticeDestino) {
+			funcion(verticeOrigen, verticeDestino, contexto);
+		});
+	}
+
+	/*
+	* Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	* Postcondiciones: Llama a @funcion con (@vertice, vecino) por cada entrada de la lista de @vertice, en el orden en que estan guardadas
+	* (con repetidos si el grafo los tiene). Si @vertice no pertenece a @grafo no hace nada
+	*/
+	void ParaCadaAdyacente(const Grafo* grafo, int vertice, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return;
+		}
+		for (int vecino : grafo->listaAdyacencia[vertice]) {
+			funcion(vertice, vecino, contexto);
+		}
+	}
+
+	/*
+ * Precondiciones:
  * - @nombre es un nombre válido para el grafo.
  * - @tipo es un valor de TipoGrafo (DIRIGIDO o NODIRIGIDO).
  * - @cantidadVertices es mayor o igual a cero.
  *
  * Postcondiciones:
  * - Devuelve un puntero a un nuevo Grafo inicializado con el nombre, tipo, identificador único, y lista de adyacencia de tamaño @cantidadVertices.
+ * - Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso.
  */
-	Grafo* InicializarGrafo(const string& nombre, TipoGrafo tipo, int cantidadVertices) {
-		Grafo* nuevoGrafo = new Grafo;
+	Grafo* InicializarGrafo(const string& nombre, TipoGrafo tipo, int cantidadVertices, std::pmr::memory_resource* recurso) {
+		Grafo* nuevoGrafo = new Grafo(RecursoOPorDefecto(recurso));
 		nuevoGrafo->nombre = nombre;
 		nuevoGrafo->id = GenerarIdentificadorUnico();
 		nuevoGrafo->tipo = tipo;
 		nuevoGrafo->cantidadVertices = cantidadVertices;
 		nuevoGrafo->listaAdyacencia.resize(cantidadVertices);
+		RecalcularEstadisticas(nuevoGrafo);
 
 		return nuevoGrafo;
 	}
 
 	/*
-	 * Precondiciones: @grafo1 y @grafo2 son instancias validas creadas con alguna de las primitivas creacionales
-	 * Postcondiciones: Devuelve una instancia nueva de Grafo que es la union de conjuntos de los vertices y aristas de @grafo1 y @grafo2
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Cambia el modo en que @grafo guarda los vecinos de cada vertice.
+	 * Al pasar a ORDENADA los vecinos existentes se ordenan y se eliminan los repetidos
 	 */
-	Grafo* ObtenerUnion(const Grafo* grafo1, const Grafo* grafo2) {
-		if (grafo1->tipo != grafo2->tipo) {
-			return nullptr;
+	void CambiarModoAdyacencia(Grafo* grafo, ModoAdyacencia modo) {
+		if (!grafo || grafo->modo == modo) {
+			return;
+		}
+		grafo->modo = modo;
+		if (modo == ORDENADA) {
+			for (FilaAdyacencia& vecinos : grafo->listaAdyacencia) {
+				std::sort(vecinos.begin(), vecinos.end());
+				vecinos.erase(std::unique(vecinos.begin(), vecinos.end()), vecinos.end());
+			}
+			RecalcularEstadisticas(grafo);
 		}
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve el modo en que @grafo guarda los vecinos de cada vertice
+	 */
+	ModoAdyacencia ObtenerModoAdyacencia(const Grafo* grafo) {
+		return grafo->modo;
+	}
+
+	// A partir de esta cantidad de vertices las filas de la union se combinan en varios hilos
+	const int MINIMO_VERTICES_UNION_PARALELA = 2048;
 
-		Grafo* grafoUnion = InicializarGrafo("Union_" + grafo1->nombre + "_" + grafo2->nombre, grafo1->tipo,
-			std::max(grafo1->cantidadVertices, grafo2->cantidadVertices));
+	/*
+	 * Posicion de lectura dentro de una fila ordenada durante la mezcla de ObtenerUnion
+	 */
+	struct CursorFila {
+		const int* actual;
+		const int* fin;
+	};
 
-		for (int indiceVerticeGrafo1 = 0; indiceVerticeGrafo1 < grafo1->cantidadVertices; ++indiceVerticeGrafo1) {
-			for (int verticeAdyacente : grafo1->listaAdyacencia[indiceVerticeGrafo1]) {
-				grafoUnion->listaAdyacencia[indiceVerticeGrafo1].push_back(verticeAdyacente);
+	/*
+	 * Mezcla las filas ordenadas de @cursores en @destino sin repetidos, en O(d log K) para K filas con d vecinos en total
+	 */
+	static void MezclarFilas(vector<CursorFila>& cursores, vector<int>& destino) {
+		auto mayorPrimero = [](const CursorFila& a, const CursorFila& b) { return *a.actual > *b.actual; };
+		destino.clear();
+		cursores.erase(std::remove_if(cursores.begin(), cursores.end(),
+			[](const CursorFila& cursor) { return cursor.actual == cursor.fin; }), cursores.end());
+		std::make_heap(cursores.begin(), cursores.end(), mayorPrimero);
+		while (!cursores.empty()) {
+			std::pop_heap(cursores.begin(), cursores.end(), mayorPrimero);
+			CursorFila& cursor = cursores.back();
+			if (destino.empty() || destino.back() != *cursor.actual) {
+				destino.push_back(*cursor.actual);
+			}
+			if (++cursor.actual == cursor.fin) {
+				cursores.pop_back();
+			}
+			else {
+				std::push_heap(cursores.begin(), cursores.end(), mayorPrimero);
 			}
 		}
+	}
 
-		if (grafoUnion->tipo == DIRIGIDO) {
-			for (int indiceVerticeGrafo2 = 0; indiceVerticeGrafo2 < grafo2->cantidadVertices; ++indiceVerticeGrafo2) {
-				for (int verticeAdyacente : grafo2->listaAdyacencia[indiceVerticeGrafo2]) {
-					grafoUnion->listaAdyacencia[indiceVerticeGrafo2].push_back(verticeAdyacente);
-				}
-			}
+	/*
+	 * Precondiciones: @grafos apunta a @cantidadGrafos instancias validas creadas con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve una instancia nueva de Grafo que es la union de conjuntos de los vertices y aristas de todos los grafos,
+	 * en modo ORDENADA (vecinos ordenados y sin repetidos). Si los grafos no son todos del mismo tipo o @cantidadGrafos es cero devuelve NULL
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL).
+	 * Las filas se mezclan en paralelo solo si ese recurso es new_delete_resource; con cualquier otro se usa un solo hilo
+	 */
+	Grafo* ObtenerUnion(const Grafo* const* grafos, size_t cantidadGrafos, std::pmr::memory_resource* recurso) {
+		if (cantidadGrafos == 0) {
+			return nullptr;
 		}
 
-		else {
-			vector<vector<bool>> aristaAgregada(grafoUnion->cantidadVertices, vector<bool>(grafoUnion->cantidadVertices, false));
+		string nombre = "Union";
+		int cantidadVertices = 0;
+		for (size_t k = 0; k < cantidadGrafos; ++k) {
+			if (grafos[k]->tipo != grafos[0]->tipo) {
+				return nullptr;
+			}
+			nombre += "_" + grafos[k]->nombre;
+			cantidadVertices = std::max(cantidadVertices, grafos[k]->cantidadVertices);
+		}
 
-			for (int indiceVerticeGrafo1 = 0; indiceVerticeGrafo1 < grafo1->cantidadVertices; ++indiceVerticeGrafo1) {
-				for (int verticeAdyacente : grafo1->listaAdyacencia[indiceVerticeGrafo1]) {
-					aristaAgregada[indiceVerticeGrafo1][verticeAdyacente] = aristaAgregada[verticeAdyacente][indiceVerticeGrafo1] = true;
-				}
+		Grafo* grafoUnion = InicializarGrafo(nombre, grafos[0]->tipo, cantidadVertices, recurso);
+		grafoUnion->modo = ORDENADA;
 
-				for (int indiceVerticeGrafo2 = 0; indiceVerticeGrafo2 < grafo2->cantidadVertices; ++indiceVerticeGrafo2) {
-					for (int verticeAdyacente : grafo2->listaAdyacencia[indiceVerticeGrafo2]) {
-						if (!aristaAgregada[indiceVerticeGrafo2][verticeAdyacente]) {
-							grafoUnion->listaAdyacencia[indiceVerticeGrafo2].push_back(verticeAdyacente);
-							aristaAgregada[indiceVerticeGrafo2][verticeAdyacente] = aristaAgregada[verticeAdyacente][indiceVerticeGrafo2] = true;
-						}
+		// Cada fila de la union es la mezcla de las filas de ese vertice en cada grafo. Las filas en modo
+		// ORDENADA se mezclan tal cual; las demas se copian y ordenan antes. No hace falta memoria de V x V
+		auto unirRango = [&](int desde, int hasta) {
+			vector<vector<int>> filasOrdenadas(cantidadGrafos);
+			vector<CursorFila> cursores;
+			vector<int> mezcla;
+			for (int vertice = desde; vertice < hasta; ++vertice) {
+				cursores.clear();
+				for (size_t k = 0; k < cantidadGrafos; ++k) {
+					if (vertice >= grafos[k]->cantidadVertices) {
+						continue;
+					}
+					const FilaAdyacencia& fila = grafos[k]->listaAdyacencia[vertice];
+					if (grafos[k]->modo == ORDENADA) {
+						cursores.push_back({ fila.data(), fila.data() + fila.size() });
+					}
+					else {
+						filasOrdenadas[k].assign(fila.begin(), fila.end());
+						std::sort(filasOrdenadas[k].begin(), filasOrdenadas[k].end());
+						cursores.push_back({ filasOrdenadas[k].data(), filasOrdenadas[k].data() + filasOrdenadas[k].size() });
 					}
 				}
+				MezclarFilas(cursores, mezcla);
+				grafoUnion->listaAdyacencia[vertice].assign(mezcla.begin(), mezcla.end());
 			}
+		};
 
-			return grafoUnion;
+		// Cada hilo pide al recurso del resultado la memoria de sus filas
+		unsigned int hilos = cantidadVertices >= MINIMO_VERTICES_UNION_PARALELA ? HilosParaFilas(grafoUnion, HilosDisponibles()) : 1;
+		EjecutarPorRangos(DividirEnRangos(cantidadVertices, hilos), unirRango);
 
-		}
+		RecalcularEstadisticas(grafoUnion);
+		VerificarDensidad(grafoUnion);
+		return grafoUnion;
+	}
+
+	/*
+	 * Precondiciones: @grafo1 y @grafo2 son instancias validas creadas con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve una instancia nueva de Grafo que es la union de conjuntos de los vertices y aristas de @grafo1 y @grafo2
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL)
+	 */
+	Grafo* ObtenerUnion(const Grafo* grafo1, const Grafo* grafo2, std::pmr::memory_resource* recurso) {
+		const Grafo* grafos[] = { grafo1, grafo2 };
+		return ObtenerUnion(grafos, 2, recurso);
 	}
 
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Devuelve una instancia nueva del Grafo que es el complemento de @grafo
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL).
+	 * Las filas se calculan en paralelo solo si ese recurso es new_delete_resource; con cualquier otro se usa un solo hilo
 	 */
-	Grafo* ObtenerGrafoComplementario(const Grafo* grafo) {
+	Grafo* ObtenerGrafoComplementario(const Grafo* grafo, std::pmr::memory_resource* recurso) {
 		if (!grafo) {
 			return nullptr;
 		}
 
-		Grafo* grafoComplementario = InicializarGrafo("Complemento_" + grafo->nombre, grafo->tipo, grafo->cantidadVertices);
+		Grafo* grafoComplementario = InicializarGrafo("Complemento_" + grafo->nombre, grafo->tipo, grafo->cantidadVertices, recurso);
+		grafoComplementario->modo = grafo->modo;
 
-		// Recorremos todos los pares de vértices para encontrar los que no son adyacentes
-		for (int verticeOrigen = 0; verticeOrigen < grafo->cantidadVertices; ++verticeOrigen) {
-			for (int verticeDestino = 0; verticeDestino < grafo->cantidadVertices; ++verticeDestino) {
-				// Para grafos dirigidos o para evitar duplicados en grafos no dirigidos
-				if ((grafo->tipo == DIRIGIDO) || (verticeDestino > verticeOrigen)) {
-					if (!SonAdyacentes(grafo, verticeOrigen, verticeDestino) && verticeOrigen != verticeDestino) {
-						grafoComplementario->listaAdyacencia[verticeOrigen].push_back(verticeDestino);
-						if (grafo->tipo == NODIRIGIDO) {
-							grafoComplementario->listaAdyacencia[verticeDestino].push_back(verticeOrigen);
-						}
+		int cantidadVertices = grafo->cantidadVertices;
+		size_t palabrasPorFila = (cantidadVertices + 63) / 64;
+		long long paresPosibles = static_cast<long long>(cantidadVertices) * cantidadVertices;
+
+		// El complemento de un grafo ralo es denso: en ese caso cada fila se escribe directamente en la matriz de bits del resultado
+		bool complementoDenso = cantidadVertices > 0 &&
+			(paresPosibles - grafo->entradasAdyacencia) * DIVISOR_DENSIDAD_MATRIZ >= paresPosibles;
+		if (complementoDenso) {
+			grafoComplementario->palabrasPorFila = palabrasPorFila;
+			grafoComplementario->matrizAdyacencia.assign(palabrasPorFila * cantidadVertices, 0);
+		}
+
+		// Cada fila del complemento es el NOT de la fila de bits del vertice, sin el propio vertice.
+		// Las filas son independientes, asi que se reparten por rangos entre los hilos
+		auto complementarRango = [&](int desde, int hasta) {
+			vector<uint64_t> filaAuxiliar(grafo->matrizAdyacencia.empty() ? palabrasPorFila : 0);
+			vector<uint64_t> filaComplemento(complementoDenso ? 0 : palabrasPorFila);
+
+			for (int verticeOrigen = desde; verticeOrigen < hasta; ++verticeOrigen) {
+				const uint64_t* fila;
+				if (!grafo->matrizAdyacencia.empty()) {
+					fila = ObtenerFilaMatriz(grafo, verticeOrigen);
+				}
+				else {
+					std::fill(filaAuxiliar.begin(), filaAuxiliar.end(), 0);
+					for (int vecino : grafo->listaAdyacencia[verticeOrigen]) {
+						filaAuxiliar[vecino >> 6] |= uint64_t(1) << (vecino & 63);
+					}
+					fila = filaAuxiliar.data();
+				}
+
+				uint64_t* destino = complementoDenso
+					? grafoComplementario->matrizAdyacencia.data() + verticeOrigen * palabrasPorFila
+					: filaComplemento.data();
+				for (size_t palabra = 0; palabra < palabrasPorFila; ++palabra) {
+					destino[palabra] = ~fila[palabra] & MascaraPalabra(grafo, palabra);
+				}
+				destino[verticeOrigen >> 6] &= ~(uint64_t(1) << (verticeOrigen & 63));
+
+				// Pasar los bits a la lista, en orden creciente como los agregaba el recorrido por pares
+				size_t cantidadVecinos = 0;
+				for (size_t palabra = 0; palabra < palabrasPorFila; ++palabra) {
+					cantidadVecinos += ContarBits(destino[palabra]);
+				}
+				FilaAdyacencia& vecinos = grafoComplementario->listaAdyacencia[verticeOrigen];
+				vecinos.reserve(cantidadVecinos);
+				for (size_t palabra = 0; palabra < palabrasPorFila; ++palabra) {
+					for (uint64_t bits = destino[palabra]; bits != 0; bits &= bits - 1) {
+						vecinos.push_back(static_cast<int>(palabra * 64) + PosicionPrimerBit(bits));
 					}
 				}
 			}
-		}
+		};
 
+		// Cada hilo pide al recurso del resultado la memoria de sus filas
+		unsigned int hilos = cantidadVertices >= MINIMO_VERTICES_COMPLEMENTO_PARALELO ? HilosParaFilas(grafoComplementario, HilosDisponibles()) : 1;
+		EjecutarPorRangos(DividirEnRangos(cantidadVertices, hilos), complementarRango);
+
+		RecalcularEstadisticas(grafoComplementario);
+		VerificarDensidad(grafoComplementario);
 		return grafoComplementario;
 	}
 
@@ -292,12 +1236,46 @@ namespace URGGrafo {
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Asocia la etiqueta @etiqueta al vertive @vertice de @grafo. Si ya tenia etiqueta la sobreescribe por @etiqueta
 	 */
-	unordered_map<const Grafo*, unordered_map<int, string>> etiquetasVertices;
-	void AgregarEtiqueta(Grafo* grafo, int vertice, string etiqueta) {
+	void AgregarEtiqueta(Grafo* grafo, int vertice, std::string_view etiqueta) {
 		if (!grafo || vertice < 0 || vertice >= grafo->cantidadVertices) {
 			return;
 		}
-		etiquetasVertices[grafo][vertice] = etiqueta;
+		AsignarEtiqueta(grafo->etiquetas, grafo->cantidadVertices, vertice, etiqueta);
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la etiqueta de @vertice. Si no tiene etiqueta o no pertenece a @grafo devuelve un string vacio
+	 */
+	string ObtenerEtiqueta(const Grafo* grafo, int vertice) {
+		if (!grafo || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return "";
+		}
+		return string(EtiquetaDeVertice(grafo->etiquetas, vertice));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Igual que ObtenerEtiqueta pero sin copiar la etiqueta. Deja de ser valida con el siguiente
+	 * AgregarEtiqueta sobre @grafo o al destruirlo
+	 */
+	std::string_view VerEtiqueta(const Grafo* grafo, int vertice) {
+		if (!grafo || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return std::string_view();
+		}
+		return EtiquetaDeVertice(grafo->etiquetas, vertice);
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve el vertice de @grafo que tiene la etiqueta @etiqueta (si hay varios, el ultimo que la recibio de los que todavia la tienen).
+	 * Si ningun vertice tiene esa etiqueta devuelve -1
+	 */
+	int ObtenerVerticePorEtiqueta(const Grafo* grafo, std::string_view etiqueta) {
+		if (!grafo) {
+			return -1;
+		}
+		return VerticeDeEtiqueta(grafo->etiquetas, etiqueta);
 	}
 
 	/*
@@ -309,18 +1287,11 @@ namespace URGGrafo {
 			return false;
 		}
 
-		int numVertices = grafo->cantidadVertices;
-
-		for (int verticeOrigen = 0; verticeOrigen < numVertices; ++verticeOrigen) {
-			for (int verticeDestino = 0; verticeDestino < numVertices; ++verticeDestino) {
-				if (verticeOrigen != verticeDestino) {
-					if (!SonAdyacentes(grafo, verticeOrigen, verticeDestino)) {
-						return false;
-					}
-				}
-			}
-		}
-		return true;
+		// Es completo si cada vertice tiene como vecinos distintos a todos los demas, es decir
+		// si la suma de los grados simples es V * (V - 1)
+		ActualizarEstadisticas(grafo);
+		long long numVertices = grafo->cantidadVertices;
+		return grafo->sumaGradosSimples == numVertices * (numVertices - 1);
 	}
 
 	/*
@@ -333,31 +1304,17 @@ namespace URGGrafo {
 			return "";
 		}
 
-		std::vector<int> grados;
-
-		// Calcular el grado de cada vértice y agregarlo al vector de grados
-		for (int i = 0; i < grafo->cantidadVertices; ++i) {
-			int grado = 0;
-
-			// Contar cuántos vértices están conectados al vértice actual
-			for (int j = 0; j < grafo->cantidadVertices; ++j) {
-				if (i != j && SonAdyacentes(grafo, i, j)) {
-					++grado;
-				}
-			}
-
-			grados.push_back(grado);
-		}
-
-		// Ordenar los grados en orden descendente
-		std::sort(grados.begin(), grados.end(), std::greater<int>());
-
-		// Convertir el vector de grados a un string separado por comas
+		// Los grados ya estan contados en el histograma: se emiten de mayor a menor (counting sort)
+		ActualizarEstadisticas(grafo);
 		std::ostringstream resultado;
-		for (size_t i = 0; i < grados.size(); ++i) {
-			resultado << grados[i];
-			if (i != grados.size() - 1) {
-				resultado << ",";
+		bool primero = true;
+		for (int grado = grafo->gradoSimpleMaximo; grado >= 0; --grado) {
+			for (int repeticion = 0; repeticion < grafo->histogramaGrados[grado]; ++repeticion) {
+				if (!primero) {
+					resultado << ",";
+				}
+				resultado << grado;
+				primero = false;
 			}
 		}
 
@@ -375,6 +1332,62 @@ namespace URGGrafo {
 		return grafo->cantidadVertices;
 	}
 
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve si @grafo es DIRIGIDO o NODIRIGIDO
+	 */
+	TipoGrafo ObtenerTipo(const Grafo* grafo) {
+		return grafo->tipo;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de aristas guardadas en @grafo, incluidos lazos y aristas repetidas.
+	 * En un grafo no dirigido cada arista cuenta una sola vez
+	 */
+	long long ObtenerCantidadAristas(const Grafo* grafo) {
+		if (grafo == nullptr) {
+			return 0;
+		}
+		return grafo->cantidadAristas;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de lazos (aristas de un vertice a si mismo) de @grafo
+	 */
+	long long ObtenerCantidadLazos(const Grafo* grafo) {
+		if (grafo == nullptr) {
+			return 0;
+		}
+		return grafo->cantidadLazos;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de aristas de @grafo que repiten una adyacencia ya existente (multiaristas)
+	 */
+	long long ObtenerCantidadAristasRepetidas(const Grafo* grafo) {
+		if (grafo == nullptr) {
+			return 0;
+		}
+		ActualizarEstadisticas(grafo);
+		return grafo->cantidadAristasRepetidas;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve un vector donde la posicion g tiene la cantidad de vertices de @grafo con g vecinos distintos
+	 * (sin contar lazos). El vector llega hasta el mayor grado presente
+	 */
+	vector<int> ObtenerHistogramaGrados(const Grafo* grafo) {
+		if (grafo == nullptr) {
+			return vector<int>();
+		}
+		ActualizarEstadisticas(grafo);
+		return vector<int>(grafo->histogramaGrados.begin(), grafo->histogramaGrados.begin() + grafo->gradoSimpleMaximo + 1);
+	}
+
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Cambia el nombre que tiene @grafo por @nombre
@@ -383,7 +1396,7 @@ namespace URGGrafo {
 		if (!grafo) {
 			return;
 		}
-		grafo->nombre = nombre;
+		grafo->nombre = std::move(nombre);
 	}
 
 	/*
@@ -394,7 +1407,954 @@ namespace URGGrafo {
 		if (grafo == nullptr) {
 			return;
 		}
+		// Con un recurso monotono (arena) liberar las filas no hace nada: la memoria se recupera toda junta
+		// cuando el llamador libera el recurso
 		grafo->listaAdyacencia.clear();
 		delete grafo;
 	}
+
+	/*
+	 * CSR de un grafo congelado en memoria. La direccion y el ancho de los vertices se eligen al congelar: uint16_t
+	 * si los vertices entran, uint32_t si no. std::monostate indica un grafo cargado de un .urgb
+	 */
+	typedef std::variant<std::monostate, GrafoT<DIRIGIDO, uint16_t>, GrafoT<DIRIGIDO, uint32_t>,
+		GrafoT<NODIRIGIDO, uint16_t>, GrafoT<NODIRIGIDO, uint32_t>> NucleoCongelado;
+
+	struct GrafoCongelado {
+		string id;
+		string nombre;
+		int cantidadVertices = 0;
+		TipoGrafo tipo = DIRIGIDO;
+		NucleoCongelado nucleo;
+		TablaEtiquetas etiquetas;
+		// Si el grafo se cargo de un .urgb, nucleo queda en std::monostate: las filas se decodifican
+		// al recorrerlas directamente desde el archivo mapeado
+		URGArchivoMapeado::ArchivoMapeado* archivo = nullptr;
+		const uint64_t* offsetsCodificados = nullptr;
+		const uint8_t* filasCodificadas = nullptr;
+	};
+
+	/*
+	 * Llama a @funcion con el GrafoT de @grafo, ya resuelto en su direccion y ancho de vertice. Es la unica bifurcacion
+	 * en tiempo de ejecucion: lo que @funcion haga con el GrafoT se compila por separado para cada instancia.
+	 * En un grafo cargado de un .urgb no hace nada
+	 */
+	template <typename Funcion>
+	static void DespacharNucleo(const GrafoCongelado* grafo, Funcion&& funcion) {
+		std::visit([&funcion](const auto& nucleo) {
+			if constexpr (!std::is_same<typename std::decay<decltype(nucleo)>::type, std::monostate>::value) {
+				funcion(&nucleo);
+			}
+		}, grafo->nucleo);
+	}
+
+	/*
+	 * Llama a @funcion con cada vecino de @vertice, de menor a mayor, hasta que devuelva false.
+	 * En un grafo cargado de un .urgb decodifica la fila del archivo mapeado
+	 */
+	template <typename Funcion>
+	static void RecorrerFila(const GrafoCongelado* grafo, int vertice, Funcion&& funcion) {
+		if (grafo->archivo == nullptr) {
+			DespacharNucleo(grafo, [vertice, &funcion](const auto* nucleo) {
+				auto fila = ObtenerVecinos(nucleo, vertice);
+				for (auto vecino = fila.first; vecino != fila.second; ++vecino) {
+					if (!funcion(static_cast<int>(*vecino))) {
+						return;
+					}
+				}
+			});
+			return;
+		}
+
+		const uint8_t* posicion = grafo->filasCodificadas + grafo->offsetsCodificados[vertice];
+		const uint8_t* fin = grafo->filasCodificadas + grafo->offsetsCodificados[vertice + 1];
+		uint64_t cantidad = 0;
+		uint64_t vecino = 0;
+		posicion = URGFormatoBinario::LeerVarint(posicion, fin, cantidad);
+		for (uint64_t i = 0; posicion != nullptr && i < cantidad; ++i) {
+			uint64_t diferencia;
+			posicion = URGFormatoBinario::LeerVarint(posicion, fin, diferencia);
+			if (posicion == nullptr) {
+				return;
+			}
+			vecino += diferencia;
+			if (vecino >= static_cast<uint64_t>(grafo->cantidadVertices) || !funcion(static_cast<int>(vecino))) {
+				return;
+			}
+		}
+	}
+
+	/*
+	 * Cantidad de vecinos guardados de @vertice. En un grafo cargado de un .urgb es el primer varint de la fila
+	 */
+	static int GradoFila(const GrafoCongelado* grafo, int vertice) {
+		if (grafo->archivo == nullptr) {
+			int grado = 0;
+			DespacharNucleo(grafo, [vertice, &grado](const auto* nucleo) {
+				grado = static_cast<int>(ObtenerGrado(nucleo, vertice));
+			});
+			return grado;
+		}
+		uint64_t cantidad = 0;
+		URGFormatoBinario::LeerVarint(grafo->filasCodificadas + grafo->offsetsCodificados[vertice],
+			grafo->filasCodificadas + grafo->offsetsCodificados[vertice + 1], cantidad);
+		return static_cast<int>(cantidad);
+	}
+
+	/*
+	 * Cantidad de vecinos distintos de @vertice sin contar lazos, sobre una fila ordenada del CSR
+	 */
+	static int ContarVecinosDistintos(const GrafoCongelado* grafo, int vertice) {
+		int cantidad = 0;
+		int anterior = -1;
+		RecorrerFila(grafo, vertice, [&](int vecino) {
+			if (vecino != vertice && vecino != anterior) {
+				++cantidad;
+			}
+			anterior = vecino;
+			return true;
+		});
+		return cantidad;
+	}
+
+	/*
+	 * Copia las filas de @grafo al nucleo de @congelado como GrafoT<Direccion, VerticeT>
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	static void CongelarNucleo(GrafoCongelado* congelado, const Grafo* grafo) {
+		GrafoT<Direccion, VerticeT>& nucleo = congelado->nucleo.emplace<GrafoT<Direccion, VerticeT>>();
+		nucleo.cantidadVertices = static_cast<size_t>(grafo->cantidadVertices);
+
+		// Primera pasada: offsets a partir de los grados, para reservar el arreglo de vecinos exacto
+		nucleo.offsets.resize(nucleo.cantidadVertices + 1, 0);
+		for (int i = 0; i < grafo->cantidadVertices; ++i) {
+			nucleo.offsets[i + 1] = nucleo.offsets[i] + grafo->listaAdyacencia[i].size();
+		}
+
+		// Segunda pasada: copia contigua de los vecinos y orden de cada fila para busqueda binaria
+		nucleo.vecinos.resize(nucleo.offsets[nucleo.cantidadVertices]);
+		for (int i = 0; i < grafo->cantidadVertices; ++i) {
+			std::transform(grafo->listaAdyacencia[i].begin(), grafo->listaAdyacencia[i].end(),
+				nucleo.vecinos.begin() + nucleo.offsets[i], [](int vecino) { return static_cast<VerticeT>(vecino); });
+		}
+		OrdenarFilas(&nucleo);
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve una instancia nueva de GrafoCongelado con el nombre, identificador, tipo, vertices y aristas de @grafo.
+	 * Los vecinos de cada vertice quedan ordenados de menor a mayor. Las modificaciones posteriores de @grafo no afectan a la vista.
+	 * Si @grafo es NULL devuelve NULL
+	 */
+	GrafoCongelado* CongelarGrafo(const Grafo* grafo) {
+		if (grafo == nullptr) {
+			return nullptr;
+		}
+
+		GrafoCongelado* congelado = new GrafoCongelado;
+		congelado->id = grafo->id;
+		congelado->nombre = grafo->nombre;
+		congelado->tipo = grafo->tipo;
+		congelado->cantidadVertices = grafo->cantidadVertices;
+		congelado->etiquetas = grafo->etiquetas;
+
+		bool angosto = EntraEnVertice<uint16_t>(grafo->cantidadVertices);
+		if (grafo->tipo == DIRIGIDO) {
+			angosto ? CongelarNucleo<DIRIGIDO, uint16_t>(congelado, grafo) : CongelarNucleo<DIRIGIDO, uint32_t>(congelado, grafo);
+		} else {
+			angosto ? CongelarNucleo<NODIRIGIDO, uint16_t>(congelado, grafo) : CongelarNucleo<NODIRIGIDO, uint32_t>(congelado, grafo);
+		}
+		return congelado;
+	}
+
+	/*
+	 * Carga la seccion de etiquetas de un .urgb que empieza en @inicio. Devuelve false si esta fuera de rango o mal formada.
+	 * Los limites se comparan contra lo que resta del archivo, asi un offset corrupto no puede desbordar una suma
+	 */
+	static bool CargarEtiquetasBinarias(GrafoCongelado* grafo, const char* datos, size_t tamanio, uint64_t inicio) {
+		uint32_t cantidadEtiquetas;
+		if (inicio % 4 != 0 || inicio > tamanio || tamanio - inicio < sizeof(uint32_t)) {
+			return false;
+		}
+		std::memcpy(&cantidadEtiquetas, datos + inicio, sizeof(uint32_t));
+		uint64_t inicioOffsets = inicio + sizeof(uint32_t);
+		uint64_t restante = tamanio - inicioOffsets;
+		if (static_cast<uint64_t>(cantidadEtiquetas) + 1 > restante / sizeof(uint32_t)) {
+			return false;
+		}
+		uint64_t inicioIndices = inicioOffsets + (static_cast<uint64_t>(cantidadEtiquetas) + 1) * sizeof(uint32_t);
+		restante = tamanio - inicioIndices;
+		if (static_cast<uint64_t>(grafo->cantidadVertices) > restante / sizeof(uint32_t)) {
+			return false;
+		}
+		uint64_t inicioCaracteres = inicioIndices + static_cast<uint64_t>(grafo->cantidadVertices) * sizeof(uint32_t);
+		const uint32_t* offsets = reinterpret_cast<const uint32_t*>(datos + inicioOffsets);
+		const uint32_t* indices = reinterpret_cast<const uint32_t*>(datos + inicioIndices);
+		for (uint32_t i = 0; i < cantidadEtiquetas; ++i) {
+			if (offsets[i] > offsets[i + 1]) {
+				return false;
+			}
+		}
+		if (offsets[cantidadEtiquetas] > tamanio - inicioCaracteres) {
+			return false;
+		}
+
+		const char* caracteres = datos + inicioCaracteres;
+		for (int vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			uint32_t etiqueta = indices[vertice];
+			if (etiqueta == URGFormatoBinario::SIN_ETIQUETA) {
+				continue;
+			}
+			if (etiqueta >= cantidadEtiquetas) {
+				return false;
+			}
+			AsignarEtiqueta(grafo->etiquetas, grafo->cantidadVertices, vertice,
+				std::string_view(caracteres + offsets[etiqueta], offsets[etiqueta + 1] - offsets[etiqueta]));
+		}
+		return true;
+	}
+
+	/*
+	 * Precondiciones: -
+	 * Postcondiciones: Si @nombreArchivo es un archivo .urgb valido (ver FormatoBinario.h) lo mapea en memoria y devuelve
+	 * una instancia nueva de GrafoCongelado que lee las filas directamente del archivo, sin copiarlas ni decodificarlas
+	 * de antemano: cada fila se decodifica al recorrerla. Solo el nombre, el identificador y las etiquetas se copian.
+	 * SonAdyacentes pasa a ser lineal en el grado. Si el archivo no existe o no es valido devuelve NULL
+	 */
+	GrafoCongelado* CargarGrafoBinario(string nombreArchivo) {
+		URGArchivoMapeado::ArchivoMapeado* archivo = URGArchivoMapeado::MapearArchivo(nombreArchivo);
+		if (archivo == nullptr) {
+			return nullptr;
+		}
+		const char* datos = URGArchivoMapeado::ObtenerDatos(archivo);
+		size_t tamanio = URGArchivoMapeado::ObtenerTamanio(archivo);
+
+		URGFormatoBinario::Encabezado encabezado;
+		bool valido = tamanio >= sizeof(encabezado);
+		if (valido) {
+			std::memcpy(&encabezado, datos, sizeof(encabezado));
+			uint64_t cantidadOffsets = static_cast<uint64_t>(encabezado.cantidadVertices) + 1;
+			valido = std::memcmp(encabezado.magia, URGFormatoBinario::MAGIA, sizeof(encabezado.magia)) == 0 &&
+				encabezado.version == URGFormatoBinario::VERSION &&
+				encabezado.marcaOrden == URGFormatoBinario::MARCA_ORDEN &&
+				encabezado.cantidadVertices <= static_cast<uint32_t>(std::numeric_limits<int>::max()) &&
+				encabezado.largoNombre <= tamanio - sizeof(encabezado) &&
+				encabezado.largoIdentificador <= tamanio - sizeof(encabezado) - encabezado.largoNombre &&
+				encabezado.inicioOffsets % sizeof(uint64_t) == 0 &&
+				encabezado.inicioOffsets <= tamanio &&
+				cantidadOffsets <= (tamanio - encabezado.inicioOffsets) / sizeof(uint64_t) &&
+				encabezado.inicioFilas <= tamanio;
+		}
+		if (!valido) {
+			URGArchivoMapeado::DestruirArchivoMapeado(archivo);
+			return nullptr;
+		}
+
+		GrafoCongelado* grafo = new GrafoCongelado;
+		grafo->archivo = archivo;
+		grafo->nombre.assign(datos + sizeof(encabezado), encabezado.largoNombre);
+		grafo->id.assign(datos + sizeof(encabezado) + encabezado.largoNombre, encabezado.largoIdentificador);
+		grafo->tipo = encabezado.dirigido ? DIRIGIDO : NODIRIGIDO;
+		grafo->cantidadVertices = static_cast<int>(encabezado.cantidadVertices);
+		grafo->offsetsCodificados = reinterpret_cast<const uint64_t*>(datos + encabezado.inicioOffsets);
+		grafo->filasCodificadas = reinterpret_cast<const uint8_t*>(datos + encabezado.inicioFilas);
+
+		// Las filas tienen que quedar dentro del archivo; su contenido se valida al decodificarlas
+		valido = grafo->offsetsCodificados[0] == 0 &&
+			grafo->offsetsCodificados[grafo->cantidadVertices] <= tamanio - encabezado.inicioFilas;
+		for (int vertice = 0; valido && vertice < grafo->cantidadVertices; ++vertice) {
+			valido = grafo->offsetsCodificados[vertice] < grafo->offsetsCodificados[vertice + 1];
+		}
+		if (valido && encabezado.inicioEtiquetas != 0) {
+			valido = CargarEtiquetasBinarias(grafo, datos, tamanio, encabezado.inicioEtiquetas);
+		}
+		if (!valido) {
+			DestruirGrafo(grafo);
+			return nullptr;
+		}
+		return grafo;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el nombre de @grafo
+	 */
+	string ObtenerNombre(const GrafoCongelado* grafo) {
+		return grafo->nombre;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el identificador unico de @grafo
+	 */
+	string ObtenerIdentificador(const GrafoCongelado* grafo) {
+		return grafo->id;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerNombre(const GrafoCongelado* grafo) {
+		return grafo->nombre;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerIdentificador(const GrafoCongelado* grafo) {
+		return grafo->id;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. Caso contrario devuelve false.
+	 * La busqueda es binaria sobre los vecinos ordenados de @verticeOrigen (en los no dirigidos, sobre la fila mas corta de las dos)
+	 */
+	bool SonAdyacentes(const GrafoCongelado* grafo, int verticeOrigen, int verticeDestino) {
+		if (verticeOrigen >= 0 && verticeOrigen < grafo->cantidadVertices &&
+			verticeDestino >= 0 && verticeDestino < grafo->cantidadVertices) {
+			if (grafo->archivo == nullptr) {
+				bool adyacentes = false;
+				DespacharNucleo(grafo, [&](const auto* nucleo) {
+					adyacentes = SonAdyacentes(nucleo, verticeOrigen, verticeDestino);
+				});
+				return adyacentes;
+			}
+			// Fila codificada: se decodifica hasta pasar @verticeDestino
+			bool encontrado = false;
+			RecorrerFila(grafo, verticeOrigen, [&](int vecino) {
+				encontrado = vecino == verticeDestino;
+				return vecino < verticeDestino;
+			});
+			return encontrado;
+		}
+		return false;
+	}
+
+	/*
+	 * Recorre las aristas de @grafo con origen en [@verticeDesde, @verticeHasta), en orden de vertice origen y destino. Las filas estan ordenadas, asi que en los
+	 * no dirigidos alcanza con descartar la copia conmutativa (vecino < vertice) y los repetidos consecutivos
+	 */
+	template <typename Funcion>
+	static void RecorrerAristas(const GrafoCongelado* grafo, int verticeDesde, int verticeHasta, Funcion&& funcion) {
+		if (grafo->archivo == nullptr) {
+			// En memoria la direccion se resuelve una vez para todo el rango y no por arista
+			DespacharNucleo(grafo, [&](const auto* nucleo) {
+				ParaCadaArista(nucleo, static_cast<size_t>(verticeDesde), static_cast<size_t>(std::max(verticeHasta, verticeDesde)),
+					[&funcion](auto verticeOrigen, auto verticeDestino) {
+						funcion(static_cast<int>(verticeOrigen), static_cast<int>(verticeDestino));
+					});
+			});
+			return;
+		}
+		for (int vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+			int anterior = -1;
+			RecorrerFila(grafo, vertice, [&](int vecino) {
+				if (grafo->tipo == DIRIGIDO || (vecino >= vertice && vecino != anterior)) {
+					funcion(vertice, vecino);
+				}
+				anterior = vecino;
+				return true;
+			});
+		}
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve los vertices en un registro en formato CSV donde cada campo es un vertice
+	 */
+	string ObtenerVertices(const GrafoCongelado* grafo) {
+		if (grafo == nullptr || grafo->cantidadVertices == 0) {
+			return "Sin Vertices";
+		}
+
+		string resultado;
+		for (int i = 0; i < grafo->cantidadVertices; ++i) {
+			resultado += std::to_string(i);
+			if (i < grafo->cantidadVertices - 1) {
+				resultado += ",";
+			}
+		}
+		return resultado;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve las aristas en el mismo formato de etiquetas que ObtenerAristas(const Grafo*).
+	 * Las aristas de cada vertice aparecen ordenadas por vertice destino
+	 */
+	string ObtenerAristas(const GrafoCongelado* grafo) {
+		if (grafo == nullptr || grafo->cantidadVertices == 0) {
+			return "Sin Aristas";
+		}
+
+		string resultado;
+		RecorrerAristas(grafo, 0, grafo->cantidadVertices, [&resultado](int verticeOrigen, int verticeDestino) {
+			AgregarArista(resultado, verticeOrigen, verticeDestino);
+		});
+
+		// Eliminar el espacio final si existe
+		if (!resultado.empty() && resultado.back() == ' ') {
+			resultado.pop_back();
+		}
+
+		return resultado;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con cada vertice de @grafo, de menor a mayor, junto con su etiqueta
+	 * (vacia si no tiene) y @contexto. La etiqueta solo es valida durante la llamada
+	 */
+	void ParaCadaVertice(const GrafoCongelado* grafo, FuncionVertice funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		for (int vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			funcion(vertice, EtiquetaDeVertice(grafo->etiquetas, vertice), contexto);
+		}
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con cada arista de @grafo en el mismo orden que ObtenerAristas, sin armar texto
+	 */
+	void ParaCadaArista(const GrafoCongelado* grafo, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		RecorrerAristas(grafo, 0, grafo->cantidadVertices, [funcion, contexto](int verticeOrigen, int verticeDestino) {
+			funcion(verticeOrigen, verticeDestino, contexto);
+		});
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta).
+	 * Recorrer rangos consecutivos da las mismas aristas en el mismo orden que recorrer todo el grafo, por lo que
+	 * se pueden repartir rangos entre hilos
+	 */
+	void ParaCadaArista(const GrafoCongelado* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr) {
+			return;
+		}
+		verticeDesde = std::max(verticeDesde, 0);
+		verticeHasta = std::min(verticeHasta, grafo->cantidadVertices);
+		RecorrerAristas(grafo, verticeDesde, verticeHasta, [funcion, contexto](int verticeOrigen, int verticeDestino) {
+			funcion(verticeOrigen, verticeDestino, contexto);
+		});
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con (@vertice, vecino) por cada vecino de @vertice, de menor a mayor.
+	 * Si @vertice no pertenece a @grafo no hace nada
+	 */
+	void ParaCadaAdyacente(const GrafoCongelado* grafo, int vertice, FuncionArista funcion, void* contexto) {
+		if (grafo == nullptr || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return;
+		}
+		RecorrerFila(grafo, vertice, [&](int vecino) {
+			funcion(vertice, vecino, contexto);
+			return true;
+		});
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Si es @grafo es un grafo no dirigido devuelve el grado del vertice @vertice. Si es un grafo dirigido, devuelve el grado de salida de @vertice
+	 */
+	int ObtenerGrado(const GrafoCongelado* grafo, int vertice) {
+		if (grafo && vertice >= 0 && vertice < grafo->cantidadVertices) {
+			return GradoFila(grafo, vertice);
+		}
+		return -1;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la etiqueta de @vertice. Si no tiene etiqueta o no pertenece a @grafo devuelve un string vacio
+	 */
+	string ObtenerEtiqueta(const GrafoCongelado* grafo, int vertice) {
+		if (!grafo || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return "";
+		}
+		return string(EtiquetaDeVertice(grafo->etiquetas, vertice));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Igual que ObtenerEtiqueta pero sin copiar la etiqueta. Deja de ser valida al destruir @grafo
+	 */
+	std::string_view VerEtiqueta(const GrafoCongelado* grafo, int vertice) {
+		if (!grafo || vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return std::string_view();
+		}
+		return EtiquetaDeVertice(grafo->etiquetas, vertice);
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve el vertice de @grafo que tiene la etiqueta @etiqueta, o -1 si ningun vertice la tiene
+	 */
+	int ObtenerVerticePorEtiqueta(const GrafoCongelado* grafo, std::string_view etiqueta) {
+		if (!grafo) {
+			return -1;
+		}
+		return VerticeDeEtiqueta(grafo->etiquetas, etiqueta);
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve true si @grafo es un grafo completo. Caso contrario devuelve false
+	 */
+	bool EsCompleto(const GrafoCongelado* grafo) {
+		if (grafo == nullptr) {
+			return false;
+		}
+
+		// Es completo si cada vertice tiene como vecinos distintos a todos los demas
+		for (int vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			if (ContarVecinosDistintos(grafo, vertice) != grafo->cantidadVertices - 1) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la sucesion grafica de @grafo separados por coma
+	 */
+	string ObtenerSucesionGrafica(const GrafoCongelado* grafo) {
+		if (!grafo) {
+			return "";
+		}
+
+		std::vector<int> grados;
+		grados.reserve(grafo->cantidadVertices);
+		for (int i = 0; i < grafo->cantidadVertices; ++i) {
+			grados.push_back(ContarVecinosDistintos(grafo, i));
+		}
+
+		// Ordenar los grados en orden descendente
+		std::sort(grados.begin(), grados.end(), std::greater<int>());
+
+		std::ostringstream resultado;
+		for (size_t i = 0; i < grados.size(); ++i) {
+			resultado << grados[i];
+			if (i != grados.size() - 1) {
+				resultado << ",";
+			}
+		}
+
+		return resultado.str();
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la cantidad de vertices de @grafo
+	 */
+	int ObtenerCantidadVertices(const GrafoCongelado* grafo) {
+		if (grafo == nullptr) {
+			return 0;
+		}
+		return grafo->cantidadVertices;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo o CargarGrafoBinario
+	 * Postcondiciones: Devuelve si @grafo es DIRIGIDO o NODIRIGIDO
+	 */
+	TipoGrafo ObtenerTipo(const GrafoCongelado* grafo) {
+		return grafo->tipo;
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Libera todos los recursos asociados a @grafo
+	 */
+	void DestruirGrafo(GrafoCongelado* grafo) {
+		if (grafo != nullptr && grafo->archivo != nullptr) {
+			URGArchivoMapeado::DestruirArchivoMapeado(grafo->archivo);
+		}
+		delete grafo;
+	}
+
+	struct GrafoImplicito {
+		string id;
+		string nombre;
+		FormaImplicita forma = IMPLICITO_COMPLETO;
+		int parametro1 = 0;
+		int parametro2 = 0;
+		int cantidadVertices = 0;
+	};
+
+	/*
+	 * Llama a @funcion con cada vecino de @vertice que sea mayor o igual a @desdeVecino, de menor a mayor.
+	 * Las familias con pocos vecinos los arman en un arreglo chico; las densas los recorren como un rango
+	 */
+	template <typename Funcion>
+	static void RecorrerVecinosImplicito(const GrafoImplicito* grafo, int vertice, int desdeVecino, Funcion funcion) {
+		if (vertice < 0 || vertice >= grafo->cantidadVertices) {
+			return;
+		}
+		int n = grafo->cantidadVertices;
+		desdeVecino = std::max(desdeVecino, 0);
+		if (grafo->forma == IMPLICITO_COMPLETO) {
+			for (int vecino = desdeVecino; vecino < n; ++vecino) {
+				if (vecino != vertice) {
+					funcion(vecino);
+				}
+			}
+			return;
+		}
+		if (grafo->forma == IMPLICITO_BIPARTITO_COMPLETO) {
+			int lado = grafo->parametro1;
+			int desde = vertice < lado ? lado : 0;
+			int hasta = vertice < lado ? n : lado;
+			for (int vecino = std::max(desde, desdeVecino); vecino < hasta; ++vecino) {
+				funcion(vecino);
+			}
+			return;
+		}
+
+		int vecinos[4];
+		int cantidad = 0;
+		if (grafo->forma == IMPLICITO_CICLO) {
+			if (n >= 2) {
+				vecinos[cantidad++] = (vertice + n - 1) % n;
+			}
+			if (n >= 3) {
+				vecinos[cantidad++] = (vertice + 1) % n;
+			}
+		}
+		else if (grafo->forma == IMPLICITO_GRILLA) {
+			int columnas = grafo->parametro2;
+			int columna = vertice % columnas;
+			if (vertice >= columnas) {
+				vecinos[cantidad++] = vertice - columnas;
+			}
+			if (columna > 0) {
+				vecinos[cantidad++] = vertice - 1;
+			}
+			if (columna < columnas - 1) {
+				vecinos[cantidad++] = vertice + 1;
+			}
+			if (vertice + columnas < n) {
+				vecinos[cantidad++] = vertice + columnas;
+			}
+		}
+		else if (grafo->forma == IMPLICITO_PETERSEN) {
+			// Ciclo exterior 0..4, estrella interior 5..9 (i adyacente a i + 2 e i + 3, modulo 5) y rayos i, i + 5
+			int indice = vertice % 5;
+			int desplazamiento = vertice < 5 ? 1 : 2;
+			int base = vertice < 5 ? 0 : 5;
+			vecinos[cantidad++] = base + (indice + desplazamiento) % 5;
+			vecinos[cantidad++] = base + (indice + 5 - desplazamiento) % 5;
+			vecinos[cantidad++] = vertice < 5 ? vertice + 5 : vertice - 5;
+		}
+		std::sort(vecinos, vecinos + cantidad);
+		for (int i = 0; i < cantidad; ++i) {
+			if (vecinos[i] >= desdeVecino) {
+				funcion(vecinos[i]);
+			}
+		}
+	}
+
+	/*
+	 * Precondicion: los parametros que usa @forma no son negativos
+	 * Postcondicion: Devuelve una instancia nueva de GrafoImplicito de la familia @forma (ver FormaImplicita) con nombre @nombre
+	 * y un identificador unico. No reserva memoria proporcional a sus vertices ni a sus aristas.
+	 * Si la cantidad de vertices (@parametro1 * @parametro2 en la grilla, @parametro1 + @parametro2 en el bipartito completo)
+	 * no entra en un int devuelve NULL
+	 */
+	GrafoImplicito* CrearGrafoImplicito(string nombre, FormaImplicita forma, int parametro1, int parametro2) {
+		long long filasOLado = std::max(parametro1, 0);
+		long long columnasOLado = std::max(parametro2, 0);
+		long long cantidadVertices;
+		switch (forma) {
+		case IMPLICITO_GRILLA:
+			cantidadVertices = filasOLado * columnasOLado;
+			break;
+		case IMPLICITO_PETERSEN:
+			cantidadVertices = 10;
+			break;
+		case IMPLICITO_BIPARTITO_COMPLETO:
+			cantidadVertices = filasOLado + columnasOLado;
+			break;
+		default:
+			cantidadVertices = filasOLado;
+			break;
+		}
+		if (cantidadVertices > std::numeric_limits<int>::max()) {
+			return nullptr;
+		}
+
+		GrafoImplicito* grafo = new GrafoImplicito;
+		grafo->id = GenerarIdentificadorUnico();
+		grafo->nombre = std::move(nombre);
+		grafo->forma = forma;
+		grafo->parametro1 = static_cast<int>(filasOLado);
+		grafo->parametro2 = static_cast<int>(columnasOLado);
+		grafo->cantidadVertices = static_cast<int>(cantidadVertices);
+		return grafo;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve un Grafo no dirigido nuevo con el nombre, el identificador, los vertices y las aristas de @grafo,
+	 * con los vecinos de cada vertice de menor a mayor. Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso
+	 */
+	Grafo* MaterializarGrafo(const GrafoImplicito* grafo, std::pmr::memory_resource* recurso) {
+		Grafo* materializado = CrearGrafoNoDirigido(grafo->nombre, grafo->cantidadVertices, recurso);
+		materializado->id = grafo->id;
+		// Aristas (menor, mayor) por origen creciente: cada lista queda ordenada sin ordenarla
+		vector<std::pair<int, int>> aristas;
+		aristas.reserve(static_cast<size_t>(ObtenerCantidadAristas(grafo)));
+		ParaCadaArista(grafo, [&aristas](int verticeOrigen, int verticeDestino) {
+			aristas.emplace_back(verticeOrigen, verticeDestino);
+		});
+		ConectarLote(materializado, aristas.data(), aristas.size());
+		return materializado;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el nombre de @grafo
+	 */
+	string ObtenerNombre(const GrafoImplicito* grafo) {
+		return grafo->nombre;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el identificador unico de @grafo
+	 */
+	string ObtenerIdentificador(const GrafoImplicito* grafo) {
+		return grafo->id;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerNombre(const GrafoImplicito* grafo) {
+		return grafo->nombre;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerIdentificador(const GrafoImplicito* grafo) {
+		return grafo->id;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. Caso contrario devuelve false. Es O(1)
+	 */
+	bool SonAdyacentes(const GrafoImplicito* grafo, int verticeOrigen, int verticeDestino) {
+		int n = grafo->cantidadVertices;
+		if (verticeOrigen < 0 || verticeDestino < 0 || verticeOrigen >= n || verticeDestino >= n || verticeOrigen == verticeDestino) {
+			return false;
+		}
+		int menor = std::min(verticeOrigen, verticeDestino);
+		int mayor = std::max(verticeOrigen, verticeDestino);
+		switch (grafo->forma) {
+		case IMPLICITO_COMPLETO:
+			return true;
+		case IMPLICITO_CICLO:
+			return mayor - menor == 1 || (n >= 3 && mayor - menor == n - 1);
+		case IMPLICITO_GRILLA:
+			return mayor - menor == grafo->parametro2 || (mayor - menor == 1 && mayor % grafo->parametro2 != 0);
+		case IMPLICITO_PETERSEN: {
+			if (mayor - menor == 5) {
+				return true;
+			}
+			int distancia = (mayor - menor) % 5;
+			if (menor < 5 && mayor < 5) {
+				return distancia == 1 || distancia == 4;
+			}
+			return menor >= 5 && (distancia == 2 || distancia == 3);
+		}
+		case IMPLICITO_BIPARTITO_COMPLETO:
+			return menor < grafo->parametro1 && mayor >= grafo->parametro1;
+		}
+		return false;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con cada vertice de @grafo, de menor a mayor, con etiqueta vacia y @contexto
+	 */
+	void ParaCadaVertice(const GrafoImplicito* grafo, FuncionVertice funcion, void* contexto) {
+		for (int vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			funcion(vertice, std::string_view(), contexto);
+		}
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con cada arista de @grafo una sola vez, como (menor, mayor), ordenadas por origen y
+	 * despues por destino: el mismo orden que tendria el Grafo que devuelve MaterializarGrafo
+	 */
+	void ParaCadaArista(const GrafoImplicito* grafo, FuncionArista funcion, void* contexto) {
+		ParaCadaArista(grafo, 0, grafo->cantidadVertices, funcion, contexto);
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta),
+	 * para repartir rangos entre hilos
+	 */
+	void ParaCadaArista(const GrafoImplicito* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto) {
+		verticeDesde = std::max(verticeDesde, 0);
+		verticeHasta = std::min(verticeHasta, grafo->cantidadVertices);
+		for (int vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+			RecorrerVecinosImplicito(grafo, vertice, vertice + 1, [&](int vecino) {
+				funcion(vertice, vecino, contexto);
+			});
+		}
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con (@vertice, vecino) por cada vecino de @vertice, de menor a mayor.
+	 * Si @vertice no pertenece a @grafo no hace nada
+	 */
+	void ParaCadaAdyacente(const GrafoImplicito* grafo, int vertice, FuncionArista funcion, void* contexto) {
+		RecorrerVecinosImplicito(grafo, vertice, 0, [&](int vecino) {
+			funcion(vertice, vecino, contexto);
+		});
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el grado de @vertice (0 si no pertenece a @grafo). Es O(1)
+	 */
+	int ObtenerGrado(const GrafoImplicito* grafo, int vertice) {
+		int n = grafo->cantidadVertices;
+		if (vertice < 0 || vertice >= n) {
+			return 0;
+		}
+		switch (grafo->forma) {
+		case IMPLICITO_COMPLETO:
+			return n - 1;
+		case IMPLICITO_CICLO:
+			return n >= 3 ? 2 : n - 1;
+		case IMPLICITO_GRILLA: {
+			int columnas = grafo->parametro2;
+			int columna = vertice % columnas;
+			return (vertice >= columnas) + (columna > 0) + (columna < columnas - 1) + (vertice + columnas < n);
+		}
+		case IMPLICITO_PETERSEN:
+			return 3;
+		case IMPLICITO_BIPARTITO_COMPLETO:
+			return vertice < grafo->parametro1 ? grafo->parametro2 : grafo->parametro1;
+		}
+		return 0;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve la cantidad de vertices de @grafo
+	 */
+	int ObtenerCantidadVertices(const GrafoImplicito* grafo) {
+		return grafo->cantidadVertices;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve la cantidad de aristas de @grafo, sin recorrerlas
+	 */
+	long long ObtenerCantidadAristas(const GrafoImplicito* grafo) {
+		long long n = grafo->cantidadVertices;
+		long long filas = grafo->parametro1;
+		long long columnas = grafo->parametro2;
+		switch (grafo->forma) {
+		case IMPLICITO_COMPLETO:
+			return n * (n > 0 ? n - 1 : 0) / 2;
+		case IMPLICITO_CICLO:
+			return n >= 3 ? n : std::max(n - 1, 0LL);
+		case IMPLICITO_GRILLA:
+			return n == 0 ? 0 : filas * (columnas - 1) + (filas - 1) * columnas;
+		case IMPLICITO_PETERSEN:
+			return 15;
+		case IMPLICITO_BIPARTITO_COMPLETO:
+			return filas * columnas;
+		}
+		return 0;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve true si @grafo es un grafo completo. Caso contrario devuelve false
+	 */
+	bool EsCompleto(const GrafoImplicito* grafo) {
+		// Todas las familias son simples: es completo si tiene todas las aristas posibles
+		long long n = grafo->cantidadVertices;
+		return ObtenerCantidadAristas(grafo) == n * (n > 0 ? n - 1 : 0) / 2;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve NODIRIGIDO: todas las familias implicitas son no dirigidas
+	 */
+	TipoGrafo ObtenerTipo(const GrafoImplicito* grafo) {
+		(void)grafo;
+		return NODIRIGIDO;
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Libera todos los recursos asociados a @grafo
+	 */
+	void DestruirGrafo(GrafoImplicito* grafo) {
+		delete grafo;
+	}
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearGrafoDirigido pero el grafo queda a cargo del GrafoUnico devuelto (vacio si @cantidadVertices es negativa)
+	 */
+	GrafoUnico CrearGrafoDirigidoUnico(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso) {
+		return GrafoUnico(CrearGrafoDirigido(std::move(nombre), cantidadVertices, recurso));
+	}
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearGrafoNoDirigido pero el grafo queda a cargo del GrafoUnico devuelto (vacio si @cantidadVertices es negativa)
+	 */
+	GrafoUnico CrearGrafoNoDirigidoUnico(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso) {
+		return GrafoUnico(CrearGrafoNoDirigido(std::move(nombre), cantidadVertices, recurso));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales o NULL
+	 * Postcondiciones: Igual que CongelarGrafo pero la vista queda a cargo del GrafoCongeladoUnico devuelto
+	 */
+	GrafoCongeladoUnico CongelarGrafoUnico(const Grafo* grafo) {
+		return GrafoCongeladoUnico(CongelarGrafo(grafo));
+	}
+
+	/*
+	 * Precondiciones: -
+	 * Postcondiciones: Igual que CargarGrafoBinario pero el grafo queda a cargo del GrafoCongeladoUnico devuelto (vacio si el archivo no es valido)
+	 */
+	GrafoCongeladoUnico CargarGrafoBinarioUnico(string nombreArchivo) {
+		return GrafoCongeladoUnico(CargarGrafoBinario(std::move(nombreArchivo)));
+	}
+
+	/*
+	 * Precondicion: los parametros que usa @forma no son negativos
+	 * Postcondicion: Igual que CrearGrafoImplicito pero el grafo queda a cargo del GrafoImplicitoUnico devuelto
+	 * (vacio si la cantidad de vertices no entra en un int)
+	 */
+	GrafoImplicitoUnico CrearGrafoImplicitoUnico(string nombre, FormaImplicita forma, int parametro1, int parametro2) {
+		return GrafoImplicitoUnico(CrearGrafoImplicito(std::move(nombre), forma, parametro1, parametro2));
+	}
 }
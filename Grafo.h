@@ -3,8 +3,13 @@
 
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <list>
+#include <memory>
+#include <memory_resource>
 #include <vector>
+#include <utility>
 #include "GeneradorIdentificador.h"
 using std::string;
 using std::vector;
@@ -13,24 +18,43 @@ using std::list;
 namespace URGGrafo{
 
 	enum TipoGrafo { DIRIGIDO, NODIRIGIDO };
+
+	/*
+	 * Forma de guardar los vecinos de cada vertice:
+	 * - INSERCION: en el orden en que se conectaron, admitiendo repetidos (comportamiento por defecto)
+	 * - ORDENADA: ordenados de menor a mayor y sin repetidos. Conectar ignora las aristas que ya existen
+	 *   y SonAdyacentes hace una busqueda binaria
+	 */
+	enum ModoAdyacencia { INSERCION, ORDENADA };
 	
 	struct Grafo;
 
+	/*
+	 * Funciones que reciben los elementos de los recorridos ParaCadaVertice, ParaCadaArista y ParaCadaAdyacente.
+	 * @contexto es el mismo puntero que se le paso al recorrido
+	 */
+	typedef void (*FuncionVertice)(int vertice, std::string_view etiqueta, void* contexto);
+	typedef void (*FuncionArista)(int verticeOrigen, int verticeDestino, void* contexto);
+
 	/*
 	 * Precondicion: -
 	 * Postcondicion: Si @cantidad de vertices es un numero mayor o igual que cero
 	 * devuelve un grafo dirigido de nombre @nombre al cual se le asocia un identificador unico.
 	 * Si @cantidad de vertices es menor que cero devueleve NULL
+	 * Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso (por ejemplo una arena monotona), que debe vivir mas que el grafo.
+	 * El grafo solo pide memoria a @recurso desde un hilo a la vez, asi que no hace falta que sea seguro entre hilos
 	 */
-	Grafo* CrearGrafoDirigido(string nombre, int cantidadVertices);
+	Grafo* CrearGrafoDirigido(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso = nullptr);
 
 	/*
 	 * Precondicion: -
 	 * Postcondicion: Si @cantidad de vertices es un numero mayor o igual que cero
 	 * devuelve un grafo no dirigido de nombre @nombre al cual se le asocia un identificador unico.
 	 * Si @cantidad de vertices es menor que cero devuelve NULL
+	 * Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso (por ejemplo una arena monotona), que debe vivir mas que el grafo.
+	 * El grafo solo pide memoria a @recurso desde un hilo a la vez, asi que no hace falta que sea seguro entre hilos
 	 */
-	Grafo* CrearGrafoNoDirigido(string nombre, int cantidadVertices);
+	Grafo* CrearGrafoNoDirigido(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso = nullptr);
 
 	/*
 	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
@@ -44,14 +68,41 @@ namespace URGGrafo{
 	 */
 	string ObtenerIdentificador(const Grafo* grafo);
 
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al cambiar el nombre o destruir @grafo
+	 */
+	std::string_view VerNombre(const Grafo* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerIdentificador(const Grafo* grafo);
+
 	/*
 	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondicion: Si @grafo es un grafo no dirigido, se agrega una relacion de adyacencia conmutativa entre @verticeOrigen y @verticeDestino (@verticeOrigen es adyacente a @verticeDestino y viceversa).
 	 * Si @grafo es un grafo dirigido, se agrega una relacion de adyacencia de @verticeOrigen y @verticeDestino (@verticeOrigen es adyacente a @vertice destino)
 	 * Si @verticeOrigen o @verticeDestino no pertenece al grafo no realiza ninguna accion
+	 * Si @grafo esta en modo ORDENADA y la adyacencia ya existia no realiza ninguna accion
+	 * En modo INSERCION sin matriz de bits es O(1): los grados simples y las aristas repetidas se recalculan en O(V + E)
+	 * en la siguiente consulta que los necesite (EsCompleto, ObtenerSucesionGrafica, ObtenerHistogramaGrados, ObtenerCantidadAristasRepetidas)
 	 */
 	void Conectar(Grafo* grafo, int verticeOrigen, int verticeDestino);
 
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales.
+	 * @aristas apunta a @cantidadAristas pares (origen, destino)
+	 * Postcondicion: Equivale a llamar a Conectar con cada par de @aristas en orden, pero reserva de una vez
+	 * el espacio exacto de cada vertice y llena las listas en paralelo por trozos de @aristas, recorriendo cada arista una sola vez.
+	 * Los pares con algun vertice fuera del grafo se ignoran.
+	 * Si @deduplicar es true (o @grafo esta en modo ORDENADA) no quedan adyacencias repetidas, incluidas las que ya existian
+	 * Un lote chico frente al grafo no recorre sus V vertices. Como en Conectar, los grados simples y las aristas repetidas
+	 * se recalculan en la siguiente consulta que los necesite
+	 */
+	void ConectarLote(Grafo* grafo, const std::pair<int, int>* aristas, size_t cantidadAristas, bool deduplicar = false);
+
 	/*
 	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. Caso contrario devuelve false
@@ -78,17 +129,115 @@ namespace URGGrafo{
 	 */
 	string ObtenerAristas(const Grafo* grafo);
 
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Llama a @funcion con cada vertice de @grafo, de menor a mayor, junto con su etiqueta
+	 * (vacia si no tiene) y @contexto. La etiqueta solo es valida durante la llamada
+	 */
+	void ParaCadaVertice(const Grafo* grafo, FuncionVertice funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaVertice pero con cualquier funcion o lambda que reciba (vertice, etiqueta)
+	 */
+	template <typename Funcion>
+	void ParaCadaVertice(const Grafo* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaVertice(grafo, [](int vertice, std::string_view etiqueta, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vertice, etiqueta);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Llama a @funcion con cada arista de @grafo en el mismo orden que ObtenerAristas, sin armar texto.
+	 * En los no dirigidos cada arista se informa una sola vez, con origen menor o igual que destino
+	 */
+	void ParaCadaArista(const Grafo* grafo, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const Grafo* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta).
+	 * Recorrer rangos consecutivos da las mismas aristas en el mismo orden que recorrer todo el grafo, por lo que
+	 * se pueden repartir rangos entre hilos
+	 */
+	void ParaCadaArista(const Grafo* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista por rango pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const Grafo* grafo, int verticeDesde, int verticeHasta, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, verticeDesde, verticeHasta, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Llama a @funcion con (@vertice, vecino) por cada entrada de la lista de @vertice, en el orden en que estan guardadas
+	 * (con repetidos si el grafo los tiene). Si @vertice no pertenece a @grafo no hace nada
+	 */
+	void ParaCadaAdyacente(const Grafo* grafo, int vertice, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaAdyacente pero con cualquier funcion o lambda que reciba el vecino
+	 */
+	template <typename Funcion>
+	void ParaCadaAdyacente(const Grafo* grafo, int vertice, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaAdyacente(grafo, vertice, [](int, int vecino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vecino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Cambia el modo en que @grafo guarda los vecinos de cada vertice.
+	 * Al pasar a ORDENADA los vecinos existentes se ordenan y se eliminan los repetidos
+	 */
+	void CambiarModoAdyacencia(Grafo* grafo, ModoAdyacencia modo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve el modo en que @grafo guarda los vecinos de cada vertice
+	 */
+	ModoAdyacencia ObtenerModoAdyacencia(const Grafo* grafo);
+
 	/*
 	 * Precondiciones: @grafo1 y @grafo2 son instancias validas creadas con alguna de las primitivas creacionales
 	 * Postcondiciones: Devuelve una instancia nueva de Grafo que es la union de conjuntos de los vertices y aristas de @grafo1 y @grafo2
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL)
+	 */
+	Grafo* ObtenerUnion(const Grafo* grafo1, const Grafo* grafo2, std::pmr::memory_resource* recurso = nullptr);
+
+	/*
+	 * Precondiciones: @grafos apunta a @cantidadGrafos instancias validas creadas con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve una instancia nueva de Grafo que es la union de conjuntos de los vertices y aristas de todos los grafos,
+	 * en modo ORDENADA (vecinos ordenados y sin repetidos). Si los grafos no son todos del mismo tipo o @cantidadGrafos es cero devuelve NULL
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL).
+	 * Las filas se mezclan en paralelo solo si ese recurso es new_delete_resource; con cualquier otro se usa un solo hilo
 	 */
-	Grafo* ObtenerUnion(const Grafo* grafo1, const Grafo* grafo2);
+	Grafo* ObtenerUnion(const Grafo* const* grafos, size_t cantidadGrafos, std::pmr::memory_resource* recurso = nullptr);
 
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Devuelve una instancia nueva del Grafo que es el complemento de @grafo
+	 * La memoria de la lista de adyacencia del resultado se pide a @recurso (o al recurso por defecto si es NULL).
+	 * Las filas se calculan en paralelo solo si ese recurso es new_delete_resource; con cualquier otro se usa un solo hilo
 	 */
-	Grafo* ObtenerGrafoComplementario(const Grafo* grafo);
+	Grafo* ObtenerGrafoComplementario(const Grafo* grafo, std::pmr::memory_resource* recurso = nullptr);
 
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
@@ -100,7 +249,27 @@ namespace URGGrafo{
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Asocia la etiqueta @etiqueta al vertive @vertice de @grafo. Si ya tenia etiqueta la sobreescribe por @etiqueta
 	 */
-	void AgregarEtiqueta(Grafo* grafo, int vertice, string etiqueta);
+	void AgregarEtiqueta(Grafo* grafo, int vertice, std::string_view etiqueta);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la etiqueta de @vertice. Si no tiene etiqueta o no pertenece a @grafo devuelve un string vacio
+	 */
+	string ObtenerEtiqueta(const Grafo* grafo, int vertice);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Igual que ObtenerEtiqueta pero sin copiar la etiqueta. Deja de ser valida con el siguiente
+	 * AgregarEtiqueta sobre @grafo o al destruirlo
+	 */
+	std::string_view VerEtiqueta(const Grafo* grafo, int vertice);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve el vertice de @grafo que tiene la etiqueta @etiqueta (si hay varios, el ultimo que la recibio de los que todavia la tienen).
+	 * Si ningun vertice tiene esa etiqueta devuelve -1
+	 */
+	int ObtenerVerticePorEtiqueta(const Grafo* grafo, std::string_view etiqueta);
 
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
@@ -120,6 +289,38 @@ namespace URGGrafo{
 	 */
 	int ObtenerCantidadVertices(const Grafo* grafo);
 
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve si @grafo es DIRIGIDO o NODIRIGIDO
+	 */
+	TipoGrafo ObtenerTipo(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de aristas guardadas en @grafo, incluidos lazos y aristas repetidas.
+	 * En un grafo no dirigido cada arista cuenta una sola vez
+	 */
+	long long ObtenerCantidadAristas(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de lazos (aristas de un vertice a si mismo) de @grafo
+	 */
+	long long ObtenerCantidadLazos(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve la cantidad de aristas de @grafo que repiten una adyacencia ya existente (multiaristas)
+	 */
+	long long ObtenerCantidadAristasRepetidas(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve un vector donde la posicion g tiene la cantidad de vertices de @grafo con g vecinos distintos
+	 * (sin contar lazos). El vector llega hasta el mayor grado presente
+	 */
+	vector<int> ObtenerHistogramaGrados(const Grafo* grafo);
+
 	/*
 	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
 	 * Postcondiciones: Cambia el nombre que tiene @grafo por @nombre
@@ -140,8 +341,421 @@ namespace URGGrafo{
 	*
 	* Postcondiciones:
 	* - Devuelve un puntero a un nuevo Grafo inicializado con el nombre, tipo, identificador único, y lista de adyacencia de tamaño @cantidadVertices.
+	* - Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso.
 	*/
-	Grafo* InicializarGrafo(const string& nombre, TipoGrafo tipo, int cantidadVertices);
+	Grafo* InicializarGrafo(const string& nombre, TipoGrafo tipo, int cantidadVertices, std::pmr::memory_resource* recurso = nullptr);
+
+	/*
+	 * Grafo congelado: vista inmutable de un grafo en formato CSR (compressed sparse row).
+	 * Los vecinos de todos los vertices se guardan en un unico arreglo contiguo y un arreglo de
+	 * offsets indica donde empieza cada vertice. Pensado para grafos que se cargan una vez y se consultan muchas.
+	 * Por dentro es un GrafoT (ver GrafoT.h) con vertices de 16 bits si el grafo tiene hasta 65536 vertices y de 32 si no.
+	 * Tambien se obtiene de un archivo .urgb con CargarGrafoBinario; todas sus primitivas aceptan ambos origenes.
+	 */
+	struct GrafoCongelado;
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondiciones: Devuelve una instancia nueva de GrafoCongelado con el nombre, identificador, tipo, vertices y aristas de @grafo.
+	 * Los vecinos de cada vertice quedan ordenados de menor a mayor. Las modificaciones posteriores de @grafo no afectan a la vista.
+	 * Si @grafo es NULL devuelve NULL
+	 */
+	GrafoCongelado* CongelarGrafo(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: -
+	 * Postcondiciones: Si @nombreArchivo es un archivo .urgb valido (ver FormatoBinario.h) lo mapea en memoria y devuelve
+	 * una instancia nueva de GrafoCongelado que lee las filas directamente del archivo, sin copiarlas ni decodificarlas
+	 * de antemano: cada fila se decodifica al recorrerla. Solo el nombre, el identificador y las etiquetas se copian.
+	 * SonAdyacentes pasa a ser lineal en el grado. Si el archivo no existe o no es valido devuelve NULL
+	 */
+	GrafoCongelado* CargarGrafoBinario(string nombreArchivo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el nombre de @grafo
+	 */
+	string ObtenerNombre(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el identificador unico de @grafo
+	 */
+	string ObtenerIdentificador(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerNombre(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerIdentificador(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. Caso contrario devuelve false.
+	 * La busqueda es binaria sobre los vecinos ordenados de @verticeOrigen (en los no dirigidos, sobre la fila mas corta de las dos)
+	 */
+	bool SonAdyacentes(const GrafoCongelado* grafo, int verticeOrigen, int verticeDestino);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve los vertices en un registro en formato CSV donde cada campo es un vertice
+	 */
+	string ObtenerVertices(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve las aristas en el mismo formato de etiquetas que ObtenerAristas(const Grafo*).
+	 * Las aristas de cada vertice aparecen ordenadas por vertice destino
+	 */
+	string ObtenerAristas(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con cada vertice de @grafo, de menor a mayor, junto con su etiqueta
+	 * (vacia si no tiene) y @contexto. La etiqueta solo es valida durante la llamada
+	 */
+	void ParaCadaVertice(const GrafoCongelado* grafo, FuncionVertice funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaVertice pero con cualquier funcion o lambda que reciba (vertice, etiqueta)
+	 */
+	template <typename Funcion>
+	void ParaCadaVertice(const GrafoCongelado* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaVertice(grafo, [](int vertice, std::string_view etiqueta, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vertice, etiqueta);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con cada arista de @grafo en el mismo orden que ObtenerAristas, sin armar texto
+	 */
+	void ParaCadaArista(const GrafoCongelado* grafo, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const GrafoCongelado* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta).
+	 * Recorrer rangos consecutivos da las mismas aristas en el mismo orden que recorrer todo el grafo, por lo que
+	 * se pueden repartir rangos entre hilos
+	 */
+	void ParaCadaArista(const GrafoCongelado* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista por rango pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const GrafoCongelado* grafo, int verticeDesde, int verticeHasta, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, verticeDesde, verticeHasta, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Llama a @funcion con (@vertice, vecino) por cada vecino de @vertice, de menor a mayor.
+	 * Si @vertice no pertenece a @grafo no hace nada
+	 */
+	void ParaCadaAdyacente(const GrafoCongelado* grafo, int vertice, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaAdyacente pero con cualquier funcion o lambda que reciba el vecino
+	 */
+	template <typename Funcion>
+	void ParaCadaAdyacente(const GrafoCongelado* grafo, int vertice, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaAdyacente(grafo, vertice, [](int, int vecino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vecino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Si es @grafo es un grafo no dirigido devuelve el grado del vertice @vertice. Si es un grafo dirigido, devuelve el grado de salida de @vertice
+	 */
+	int ObtenerGrado(const GrafoCongelado* grafo, int vertice);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la etiqueta de @vertice. Si no tiene etiqueta o no pertenece a @grafo devuelve un string vacio
+	 */
+	string ObtenerEtiqueta(const GrafoCongelado* grafo, int vertice);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Igual que ObtenerEtiqueta pero sin copiar la etiqueta. Deja de ser valida al destruir @grafo
+	 */
+	std::string_view VerEtiqueta(const GrafoCongelado* grafo, int vertice);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve el vertice de @grafo que tiene la etiqueta @etiqueta, o -1 si ningun vertice la tiene
+	 */
+	int ObtenerVerticePorEtiqueta(const GrafoCongelado* grafo, std::string_view etiqueta);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve true si @grafo es un grafo completo. Caso contrario devuelve false
+	 */
+	bool EsCompleto(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la sucesion grafica de @grafo separados por coma
+	 */
+	string ObtenerSucesionGrafica(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Devuelve la cantidad de vertices de @grafo
+	 */
+	int ObtenerCantidadVertices(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo o CargarGrafoBinario
+	 * Postcondiciones: Devuelve si @grafo es DIRIGIDO o NODIRIGIDO
+	 */
+	TipoGrafo ObtenerTipo(const GrafoCongelado* grafo);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con CongelarGrafo
+	 * Postcondiciones: Libera todos los recursos asociados a @grafo
+	 */
+	void DestruirGrafo(GrafoCongelado* grafo);
+
+	/*
+	 * Grafo implicito: grafo no dirigido de una familia conocida cuya adyacencia sale de una formula, sin listas
+	 * de vecinos. Ocupa lo mismo sin importar la cantidad de vertices y aristas. Responde SonAdyacentes y ObtenerGrado
+	 * en O(1) y recorre aristas y vecinos de menor a mayor sin guardarlos. Se materializa en un Grafo solo cuando hace
+	 * falta, con MaterializarGrafo (por ejemplo para ObtenerUnion); Serializar lo recorre directamente
+	 */
+	struct GrafoImplicito;
+
+	/*
+	 * Familias de grafos implicitos y el significado de sus parametros:
+	 * - IMPLICITO_COMPLETO: K_n con n = @parametro1
+	 * - IMPLICITO_CICLO: C_n con n = @parametro1 (vertice i adyacente a i - 1 e i + 1, modulo n)
+	 * - IMPLICITO_GRILLA: @parametro1 filas por @parametro2 columnas; el vertice de la fila f y columna c es f * columnas + c
+	 * - IMPLICITO_PETERSEN: el grafo de Petersen, numerado como ObtenerGrafoPetersen (sin parametros)
+	 * - IMPLICITO_BIPARTITO_COMPLETO: K_{a,b} con a = @parametro1 y b = @parametro2; los primeros a vertices son un lado
+	 */
+	enum FormaImplicita { IMPLICITO_COMPLETO, IMPLICITO_CICLO, IMPLICITO_GRILLA, IMPLICITO_PETERSEN, IMPLICITO_BIPARTITO_COMPLETO };
+
+	/*
+	 * Precondicion: los parametros que usa @forma no son negativos
+	 * Postcondicion: Devuelve una instancia nueva de GrafoImplicito de la familia @forma (ver FormaImplicita) con nombre @nombre
+	 * y un identificador unico. No reserva memoria proporcional a sus vertices ni a sus aristas.
+	 * Si la cantidad de vertices (@parametro1 * @parametro2 en la grilla, @parametro1 + @parametro2 en el bipartito completo)
+	 * no entra en un int devuelve NULL
+	 */
+	GrafoImplicito* CrearGrafoImplicito(string nombre, FormaImplicita forma, int parametro1 = 0, int parametro2 = 0);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve un Grafo no dirigido nuevo con el nombre, el identificador, los vertices y las aristas de @grafo,
+	 * con los vecinos de cada vertice de menor a mayor. Si @recurso no es NULL la lista de adyacencia toma su memoria de @recurso
+	 */
+	Grafo* MaterializarGrafo(const GrafoImplicito* grafo, std::pmr::memory_resource* recurso = nullptr);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el nombre de @grafo
+	 */
+	string ObtenerNombre(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el identificador unico de @grafo
+	 */
+	string ObtenerIdentificador(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el nombre de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerNombre(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el identificador unico de @grafo sin copiarlo. Deja de ser valido al destruir @grafo
+	 */
+	std::string_view VerIdentificador(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. Caso contrario devuelve false. Es O(1)
+	 */
+	bool SonAdyacentes(const GrafoImplicito* grafo, int verticeOrigen, int verticeDestino);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con cada vertice de @grafo, de menor a mayor, con etiqueta vacia y @contexto
+	 */
+	void ParaCadaVertice(const GrafoImplicito* grafo, FuncionVertice funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaVertice pero con cualquier funcion o lambda que reciba (vertice, etiqueta)
+	 */
+	template <typename Funcion>
+	void ParaCadaVertice(const GrafoImplicito* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaVertice(grafo, [](int vertice, std::string_view etiqueta, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vertice, etiqueta);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con cada arista de @grafo una sola vez, como (menor, mayor), ordenadas por origen y
+	 * despues por destino: el mismo orden que tendria el Grafo que devuelve MaterializarGrafo
+	 */
+	void ParaCadaArista(const GrafoImplicito* grafo, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const GrafoImplicito* grafo, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Igual que ParaCadaArista pero solo con las aristas cuyo origen esta en [@verticeDesde, @verticeHasta),
+	 * para repartir rangos entre hilos
+	 */
+	void ParaCadaArista(const GrafoImplicito* grafo, int verticeDesde, int verticeHasta, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaArista por rango pero con cualquier funcion o lambda que reciba (verticeOrigen, verticeDestino)
+	 */
+	template <typename Funcion>
+	void ParaCadaArista(const GrafoImplicito* grafo, int verticeDesde, int verticeHasta, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaArista(grafo, verticeDesde, verticeHasta, [](int verticeOrigen, int verticeDestino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(verticeOrigen, verticeDestino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Llama a @funcion con (@vertice, vecino) por cada vecino de @vertice, de menor a mayor.
+	 * Si @vertice no pertenece a @grafo no hace nada
+	 */
+	void ParaCadaAdyacente(const GrafoImplicito* grafo, int vertice, FuncionArista funcion, void* contexto);
+
+	/*
+	 * Igual que ParaCadaAdyacente pero con cualquier funcion o lambda que reciba el vecino
+	 */
+	template <typename Funcion>
+	void ParaCadaAdyacente(const GrafoImplicito* grafo, int vertice, Funcion&& funcion) {
+		typedef typename std::remove_reference<Funcion>::type TipoFuncion;
+		ParaCadaAdyacente(grafo, vertice, [](int, int vecino, void* contexto) {
+			(*static_cast<TipoFuncion*>(contexto))(vecino);
+		}, const_cast<void*>(static_cast<const void*>(&funcion)));
+	}
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve el grado de @vertice (0 si no pertenece a @grafo). Es O(1)
+	 */
+	int ObtenerGrado(const GrafoImplicito* grafo, int vertice);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve la cantidad de vertices de @grafo
+	 */
+	int ObtenerCantidadVertices(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve la cantidad de aristas de @grafo, sin recorrerlas
+	 */
+	long long ObtenerCantidadAristas(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve true si @grafo es un grafo completo. Caso contrario devuelve false
+	 */
+	bool EsCompleto(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Devuelve NODIRIGIDO: todas las familias implicitas son no dirigidas
+	 */
+	TipoGrafo ObtenerTipo(const GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con CrearGrafoImplicito
+	 * Postcondicion: Libera todos los recursos asociados a @grafo
+	 */
+	void DestruirGrafo(GrafoImplicito* grafo);
+
+	/*
+	 * Destructor para std::unique_ptr: llama a la DestruirGrafo que corresponde al tipo de grafo
+	 */
+	struct DestructorGrafo {
+		void operator()(Grafo* grafo) const { DestruirGrafo(grafo); }
+		void operator()(GrafoCongelado* grafo) const { DestruirGrafo(grafo); }
+		void operator()(GrafoImplicito* grafo) const { DestruirGrafo(grafo); }
+	};
+
+	// Grafos que se destruyen solos al salir de alcance. get() da el puntero que reciben las demas primitivas
+	typedef std::unique_ptr<Grafo, DestructorGrafo> GrafoUnico;
+	typedef std::unique_ptr<GrafoCongelado, DestructorGrafo> GrafoCongeladoUnico;
+	typedef std::unique_ptr<GrafoImplicito, DestructorGrafo> GrafoImplicitoUnico;
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearGrafoDirigido pero el grafo queda a cargo del GrafoUnico devuelto (vacio si @cantidadVertices es negativa)
+	 */
+	GrafoUnico CrearGrafoDirigidoUnico(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso = nullptr);
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Igual que CrearGrafoNoDirigido pero el grafo queda a cargo del GrafoUnico devuelto (vacio si @cantidadVertices es negativa)
+	 */
+	GrafoUnico CrearGrafoNoDirigidoUnico(string nombre, int cantidadVertices, std::pmr::memory_resource* recurso = nullptr);
+
+	/*
+	 * Precondiciones: @grafo es una instancia valida creada con alguna de las primitivas creacionales o NULL
+	 * Postcondiciones: Igual que CongelarGrafo pero la vista queda a cargo del GrafoCongeladoUnico devuelto
+	 */
+	GrafoCongeladoUnico CongelarGrafoUnico(const Grafo* grafo);
+
+	/*
+	 * Precondiciones: -
+	 * Postcondiciones: Igual que CargarGrafoBinario pero el grafo queda a cargo del GrafoCongeladoUnico devuelto (vacio si el archivo no es valido)
+	 */
+	GrafoCongeladoUnico CargarGrafoBinarioUnico(string nombreArchivo);
+
+	/*
+	 * Precondicion: los parametros que usa @forma no son negativos
+	 * Postcondicion: Igual que CrearGrafoImplicito pero el grafo queda a cargo del GrafoImplicitoUnico devuelto
+	 * (vacio si la cantidad de vertices no entra en un int)
+	 */
+	GrafoImplicitoUnico CrearGrafoImplicitoUnico(string nombre, FormaImplicita forma, int parametro1 = 0, int parametro2 = 0);
 }
 
 #endif
@@ -0,0 +1,12 @@
+#include "GrafoT.h"
+
+namespace URGGrafo{
+
+	// Instancias de CrearGrafoT declaradas extern en GrafoT.h
+	template GrafoT<DIRIGIDO, uint16_t>* CrearGrafoT<DIRIGIDO, uint16_t>(size_t, const std::pair<uint16_t, uint16_t>*, size_t);
+	template GrafoT<DIRIGIDO, uint32_t>* CrearGrafoT<DIRIGIDO, uint32_t>(size_t, const std::pair<uint32_t, uint32_t>*, size_t);
+	template GrafoT<DIRIGIDO, uint64_t>* CrearGrafoT<DIRIGIDO, uint64_t>(size_t, const std::pair<uint64_t, uint64_t>*, size_t);
+	template GrafoT<NODIRIGIDO, uint16_t>* CrearGrafoT<NODIRIGIDO, uint16_t>(size_t, const std::pair<uint16_t, uint16_t>*, size_t);
+	template GrafoT<NODIRIGIDO, uint32_t>* CrearGrafoT<NODIRIGIDO, uint32_t>(size_t, const std::pair<uint32_t, uint32_t>*, size_t);
+	template GrafoT<NODIRIGIDO, uint64_t>* CrearGrafoT<NODIRIGIDO, uint64_t>(size_t, const std::pair<uint64_t, uint64_t>*, size_t);
+}
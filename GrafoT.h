@@ -0,0 +1,212 @@
+#ifndef GRAFOT_H_
+#define GRAFOT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Grafo.h"
+
+namespace URGGrafo{
+
+	/*
+	 * Nucleo CSR de grafo con la direccion y el ancho de los vertices fijados en compilacion. Los vecinos de todos los
+	 * vertices van en un unico arreglo de VerticeT, ordenados dentro de cada vertice, y offsets[v]..offsets[v + 1]
+	 * delimita los de v. Con VerticeT = uint16_t un grafo de hasta 65536 vertices ocupa la mitad que con int; con
+	 * uint64_t admite mas de 2^31 vertices. Los no dirigidos guardan cada arista en las dos filas.
+	 * GrafoCongelado lo usa por dentro y elige el ancho segun la cantidad de vertices
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	struct GrafoT {
+		static_assert(std::is_unsigned<VerticeT>::value, "VerticeT tiene que ser un entero sin signo");
+		typedef VerticeT Vertice;
+		static const TipoGrafo direccion = Direccion;
+
+		size_t cantidadVertices = 0;
+		std::vector<size_t> offsets;    // cantidadVertices + 1 elementos
+		std::vector<VerticeT> vecinos;
+	};
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Devuelve true si un GrafoT con vertices de tipo VerticeT puede tener @cantidadVertices vertices
+	 */
+	template <typename VerticeT>
+	bool EntraEnVertice(size_t cantidadVertices) {
+		return cantidadVertices == 0 || cantidadVertices - 1 <= static_cast<size_t>(std::numeric_limits<VerticeT>::max());
+	}
+
+	/*
+	 * Precondicion: offsets y vecinos de @grafo estan completos
+	 * Postcondicion: Ordena de menor a mayor los vecinos de cada vertice de @grafo
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	void OrdenarFilas(GrafoT<Direccion, VerticeT>* grafo) {
+		for (size_t vertice = 0; vertice < grafo->cantidadVertices; ++vertice) {
+			std::sort(grafo->vecinos.begin() + grafo->offsets[vertice], grafo->vecinos.begin() + grafo->offsets[vertice + 1]);
+		}
+	}
+
+	/*
+	 * Precondicion: Los extremos de las @cantidadAristas aristas de @aristas son menores a @cantidadVertices
+	 * Postcondicion: Devuelve un GrafoT nuevo con @cantidadVertices vertices y las aristas de @aristas, repetidas incluidas.
+	 * Si @cantidadVertices no entra en VerticeT devuelve NULL
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	GrafoT<Direccion, VerticeT>* CrearGrafoT(size_t cantidadVertices, const std::pair<VerticeT, VerticeT>* aristas, size_t cantidadAristas) {
+		if (!EntraEnVertice<VerticeT>(cantidadVertices)) {
+			return nullptr;
+		}
+		GrafoT<Direccion, VerticeT>* grafo = new GrafoT<Direccion, VerticeT>;
+		grafo->cantidadVertices = cantidadVertices;
+
+		// Conteo de grados, suma prefija y reparto: dos pasadas sobre las aristas sin filas intermedias
+		grafo->offsets.assign(cantidadVertices + 1, 0);
+		for (size_t i = 0; i < cantidadAristas; ++i) {
+			++grafo->offsets[aristas[i].first + 1];
+			if constexpr (Direccion == NODIRIGIDO) {
+				if (aristas[i].first != aristas[i].second) {
+					++grafo->offsets[aristas[i].second + 1];
+				}
+			}
+		}
+		for (size_t vertice = 0; vertice < cantidadVertices; ++vertice) {
+			grafo->offsets[vertice + 1] += grafo->offsets[vertice];
+		}
+		grafo->vecinos.resize(grafo->offsets[cantidadVertices]);
+		std::vector<size_t> siguiente(grafo->offsets.begin(), grafo->offsets.end() - 1);
+		for (size_t i = 0; i < cantidadAristas; ++i) {
+			grafo->vecinos[siguiente[aristas[i].first]++] = aristas[i].second;
+			if constexpr (Direccion == NODIRIGIDO) {
+				if (aristas[i].first != aristas[i].second) {
+					grafo->vecinos[siguiente[aristas[i].second]++] = aristas[i].first;
+				}
+			}
+		}
+		OrdenarFilas(grafo);
+		return grafo;
+	}
+
+	/*
+	 * Precondicion: @vertice es menor a la cantidad de vertices de @grafo
+	 * Postcondicion: Devuelve el rango [primero, ultimo) con los vecinos ordenados de @vertice
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	std::pair<const VerticeT*, const VerticeT*> ObtenerVecinos(const GrafoT<Direccion, VerticeT>* grafo, typename GrafoT<Direccion, VerticeT>::Vertice vertice) {
+		const VerticeT* datos = grafo->vecinos.data();
+		return std::make_pair(datos + grafo->offsets[vertice], datos + grafo->offsets[vertice + 1]);
+	}
+
+	/*
+	 * Precondicion: @vertice es menor a la cantidad de vertices de @grafo
+	 * Postcondicion: Devuelve la cantidad de vecinos guardados de @vertice (grado de salida si @grafo es dirigido)
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	size_t ObtenerGrado(const GrafoT<Direccion, VerticeT>* grafo, typename GrafoT<Direccion, VerticeT>::Vertice vertice) {
+		return grafo->offsets[vertice + 1] - grafo->offsets[vertice];
+	}
+
+	/*
+	 * Precondicion: @verticeOrigen y @verticeDestino son menores a la cantidad de vertices de @grafo
+	 * Postcondicion: Devuelve true si @verticeOrigen es adyacente a @verticeDestino. La busqueda es binaria; en los
+	 * no dirigidos se hace sobre la fila mas corta de las dos
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	bool SonAdyacentes(const GrafoT<Direccion, VerticeT>* grafo, typename GrafoT<Direccion, VerticeT>::Vertice verticeOrigen,
+		typename GrafoT<Direccion, VerticeT>::Vertice verticeDestino) {
+		if constexpr (Direccion == NODIRIGIDO) {
+			if (ObtenerGrado(grafo, verticeDestino) < ObtenerGrado(grafo, verticeOrigen)) {
+				std::swap(verticeOrigen, verticeDestino);
+			}
+		}
+		std::pair<const VerticeT*, const VerticeT*> fila = ObtenerVecinos(grafo, verticeOrigen);
+		return std::binary_search(fila.first, fila.second, verticeDestino);
+	}
+
+	/*
+	 * Precondicion: @vertice es menor a la cantidad de vertices de @grafo
+	 * Postcondicion: Llama a @funcion con cada vecino de @vertice, de menor a mayor
+	 */
+	template <TipoGrafo Direccion, typename VerticeT, typename Funcion>
+	void ParaCadaAdyacente(const GrafoT<Direccion, VerticeT>* grafo, typename GrafoT<Direccion, VerticeT>::Vertice vertice, Funcion&& funcion) {
+		std::pair<const VerticeT*, const VerticeT*> fila = ObtenerVecinos(grafo, vertice);
+		for (const VerticeT* vecino = fila.first; vecino != fila.second; ++vecino) {
+			funcion(*vecino);
+		}
+	}
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Llama a @funcion con (verticeOrigen, verticeDestino) por cada arista con origen en
+	 * [@verticeDesde, @verticeHasta), en orden de origen y destino. En los no dirigidos cada arista aparece una vez,
+	 * con verticeOrigen <= verticeDestino, y las repetidas se informan una sola vez
+	 */
+	template <TipoGrafo Direccion, typename VerticeT, typename Funcion>
+	void ParaCadaArista(const GrafoT<Direccion, VerticeT>* grafo, size_t verticeDesde, size_t verticeHasta, Funcion&& funcion) {
+		verticeHasta = std::min(verticeHasta, grafo->cantidadVertices);
+		for (size_t vertice = verticeDesde; vertice < verticeHasta; ++vertice) {
+			std::pair<const VerticeT*, const VerticeT*> fila = ObtenerVecinos(grafo, static_cast<VerticeT>(vertice));
+			if constexpr (Direccion == DIRIGIDO) {
+				for (const VerticeT* vecino = fila.first; vecino != fila.second; ++vecino) {
+					funcion(static_cast<VerticeT>(vertice), *vecino);
+				}
+			} else {
+				// Fila ordenada: se saltea la copia conmutativa (vecino < vertice) y se descartan los repetidos consecutivos
+				const VerticeT* vecino = std::lower_bound(fila.first, fila.second, static_cast<VerticeT>(vertice));
+				for (; vecino != fila.second; ++vecino) {
+					if (vecino == fila.first || *vecino != *(vecino - 1)) {
+						funcion(static_cast<VerticeT>(vertice), *vecino);
+					}
+				}
+			}
+		}
+	}
+
+	/*
+	 * Igual que ParaCadaArista por rango pero sobre todos los vertices de @grafo
+	 */
+	template <TipoGrafo Direccion, typename VerticeT, typename Funcion>
+	void ParaCadaArista(const GrafoT<Direccion, VerticeT>* grafo, Funcion&& funcion) {
+		ParaCadaArista(grafo, 0, grafo->cantidadVertices, std::forward<Funcion>(funcion));
+	}
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Devuelve la cantidad de vertices de @grafo
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	size_t ObtenerCantidadVertices(const GrafoT<Direccion, VerticeT>* grafo) {
+		return grafo->cantidadVertices;
+	}
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Devuelve DIRIGIDO o NODIRIGIDO; se resuelve en compilacion
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	constexpr TipoGrafo ObtenerTipo(const GrafoT<Direccion, VerticeT>*) {
+		return Direccion;
+	}
+
+	/*
+	 * Precondicion: @grafo fue creado con CrearGrafoT o es NULL
+	 * Postcondicion: Libera todos los recursos asociados a @grafo
+	 */
+	template <TipoGrafo Direccion, typename VerticeT>
+	void DestruirGrafo(GrafoT<Direccion, VerticeT>* grafo) {
+		delete grafo;
+	}
+
+	// CrearGrafoT se instancia una sola vez, en GrafoT.cpp, para las dos direcciones y los tres anchos de vertice
+	extern template GrafoT<DIRIGIDO, uint16_t>* CrearGrafoT<DIRIGIDO, uint16_t>(size_t, const std::pair<uint16_t, uint16_t>*, size_t);
+	extern template GrafoT<DIRIGIDO, uint32_t>* CrearGrafoT<DIRIGIDO, uint32_t>(size_t, const std::pair<uint32_t, uint32_t>*, size_t);
+	extern template GrafoT<DIRIGIDO, uint64_t>* CrearGrafoT<DIRIGIDO, uint64_t>(size_t, const std::pair<uint64_t, uint64_t>*, size_t);
+	extern template GrafoT<NODIRIGIDO, uint16_t>* CrearGrafoT<NODIRIGIDO, uint16_t>(size_t, const std::pair<uint16_t, uint16_t>*, size_t);
+	extern template GrafoT<NODIRIGIDO, uint32_t>* CrearGrafoT<NODIRIGIDO, uint32_t>(size_t, const std::pair<uint32_t, uint32_t>*, size_t);
+	extern template GrafoT<NODIRIGIDO, uint64_t>* CrearGrafoT<NODIRIGIDO, uint64_t>(size_t, const std::pair<uint64_t, uint64_t>*, size_t);
+}
+
+#endif
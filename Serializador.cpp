@@ -1,13 +1,31 @@
 #include "Serializador.h"
 #include "Escritor.h"
 #include "Grafo.h"
+#include "FormatoBinario.h"
+#include "ArchivoMapeado.h"
+#include <algorithm>
+#include <condition_variable>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace URGSerializador {
 	struct Serializador {
 		Escritor* escritor; //Puntero al escritor que lo serializa en el archivo
 		const Grafo* grafo; //Puntero al grafo que queres serializar
+		bool propietario = false; //Si el escritor lo creo el serializador y lo tiene que destruir
 	};
 
+	// Buffer del escritor de archivo que crea CrearSerializador(std::string_view): el archivo se escribe de a bloques y no por linea
+	const size_t TAMANIO_BUFFER_ESCRITOR = 1 << 16;
+
 	/*
 		 * Precondicion: @escritor es una instancia valida
 		 * Postcondicion: Crear un serializador de grafos que serializara el grafo en @escritor
@@ -24,14 +42,278 @@ namespace URGSerializador {
 		 * que tendra como nombre el siguiente: [@nombreGrafo].urg es decir el nombre del grafo con la extencion .urg
 		 * Si no puede crear un escritor de archivo con ese nombre, devuelve NULL
 		 */
-	Serializador* CrearSerializador(string nombreGrafo) {
-		string  nombreArchivo = nombreGrafo + ".urg";
-		Escritor* escritor = URGEscritor::CrearEscritorArchivo(nombreArchivo);
+	Serializador* CrearSerializador(std::string_view nombreGrafo) {
+		string nombreArchivo;
+		nombreArchivo.reserve(nombreGrafo.size() + 4);
+		nombreArchivo.append(nombreGrafo).append(".urg");
+		Escritor* escritor = URGEscritor::CrearEscritorArchivo(std::move(nombreArchivo), TAMANIO_BUFFER_ESCRITOR, URGEscritor::VACIAR_POR_TAMANIO);
 		Serializador* serializador = new Serializador;
 		serializador->escritor = escritor;
+		serializador->propietario = true;
 		return serializador;
 	}
 
+	// Tamanio del bloque en el que se arma el texto antes de pasarlo al escritor. Es toda la memoria que usa Serializar
+	const size_t TAMANIO_BUFFER_SALIDA = 1 << 16;
+
+	// Lo maximo que ocupa una linea de vertice o arista: "@" numero "-" numero "\n"
+	const size_t LARGO_MAXIMO_LINEA = 2 * (std::numeric_limits<int>::digits10 + 2) + 3;
+
+	/*
+	 * Bloque de tamanio fijo donde se formatean las lineas. Cuando se llena se pasa entero al escritor
+	 */
+	struct BufferSalida {
+		Escritor* escritor;
+		vector<char> datos = vector<char>(TAMANIO_BUFFER_SALIDA);
+		size_t usado = 0;
+	};
+
+	static void VaciarBuffer(BufferSalida& buffer) {
+		if (buffer.usado > 0) {
+			URGEscritor::EscribirBloque(buffer.escritor, buffer.datos.data(), buffer.usado);
+			buffer.usado = 0;
+		}
+	}
+
+	// Devuelve donde escribir @largo caracteres, vaciando antes el buffer si no entran
+	static char* ReservarBuffer(BufferSalida& buffer, size_t largo) {
+		if (buffer.usado + largo > buffer.datos.size()) {
+			VaciarBuffer(buffer);
+		}
+		return buffer.datos.data() + buffer.usado;
+	}
+
+	// Agrega @texto y un salto de linea. Un texto mas largo que el buffer pasa directo al escritor
+	static void AgregarLinea(BufferSalida& buffer, std::string_view texto) {
+		if (texto.size() + 1 > buffer.datos.size()) {
+			VaciarBuffer(buffer);
+			URGEscritor::EscribirBloque(buffer.escritor, texto.data(), texto.size());
+			URGEscritor::EscribirBloque(buffer.escritor, "\n", 1);
+			return;
+		}
+		char* destino = ReservarBuffer(buffer, texto.size() + 1);
+		std::memcpy(destino, texto.data(), texto.size());
+		destino[texto.size()] = '\n';
+		buffer.usado += texto.size() + 1;
+	}
+
+	// Igual que AgregarLinea con el texto partido en @partes, que se copian una tras otra sin concatenarlas antes
+	static void AgregarLinea(BufferSalida& buffer, std::initializer_list<std::string_view> partes) {
+		size_t largo = 0;
+		for (std::string_view parte : partes) {
+			largo += parte.size();
+		}
+		if (largo + 1 > buffer.datos.size()) {
+			VaciarBuffer(buffer);
+			for (std::string_view parte : partes) {
+				URGEscritor::EscribirBloque(buffer.escritor, parte.data(), parte.size());
+			}
+			URGEscritor::EscribirBloque(buffer.escritor, "\n", 1);
+			return;
+		}
+		char* destino = ReservarBuffer(buffer, largo + 1);
+		for (std::string_view parte : partes) {
+			std::memcpy(destino, parte.data(), parte.size());
+			destino += parte.size();
+		}
+		*destino = '\n';
+		buffer.usado += largo + 1;
+	}
+
+	// Escribe "@v<vertice>\n" a partir de @destino y devuelve la posicion siguiente
+	static char* FormatearVertice(char* destino, int vertice) {
+		*destino++ = '@';
+		*destino++ = 'v';
+		destino = std::to_chars(destino, destino + LARGO_MAXIMO_LINEA, vertice).ptr;
+		*destino++ = '\n';
+		return destino;
+	}
+
+	// Escribe "@<verticeOrigen>-<verticeDestino>\n" a partir de @destino y devuelve la posicion siguiente
+	static char* FormatearArista(char* destino, int verticeOrigen, int verticeDestino) {
+		*destino++ = '@';
+		destino = std::to_chars(destino, destino + LARGO_MAXIMO_LINEA, verticeOrigen).ptr;
+		*destino++ = '-';
+		destino = std::to_chars(destino, destino + LARGO_MAXIMO_LINEA, verticeDestino).ptr;
+		*destino++ = '\n';
+		return destino;
+	}
+
+	/*
+	 * Etiqueta con la que se escribe @vertice en la seccion de vertices, o vacia si se escribe su numero.
+	 * Una etiqueta con saltos de linea partiria la linea y una igual al numero del vertice se leeria como ese numero,
+	 * asi que en esos casos tambien se escribe el numero
+	 */
+	static std::string_view EtiquetaSerializable(std::string_view etiqueta, int vertice) {
+		if (etiqueta.find_first_of("\r\n") != std::string_view::npos) {
+			return {};
+		}
+		char numero[LARGO_MAXIMO_LINEA];
+		char* fin = std::to_chars(numero, numero + sizeof(numero), vertice).ptr;
+		if (etiqueta == std::string_view(numero, static_cast<size_t>(fin - numero))) {
+			return {};
+		}
+		return etiqueta;
+	}
+
+	static std::string_view EtiquetaSerializable(const Grafo* grafo, int vertice) {
+		return EtiquetaSerializable(URGGrafo::VerEtiqueta(grafo, vertice), vertice);
+	}
+
+	static std::string_view EtiquetaSerializable(const URGGrafo::GrafoCongelado* grafo, int vertice) {
+		return EtiquetaSerializable(URGGrafo::VerEtiqueta(grafo, vertice), vertice);
+	}
+
+	// Los grafos implicitos no tienen etiquetas
+	static std::string_view EtiquetaSerializable(const URGGrafo::GrafoImplicito*, int) {
+		return {};
+	}
+
+	// Escribe el encabezado, la seccion de vertices y el titulo de la seccion de aristas
+	template <typename TGrafo>
+	static void AgregarEncabezadoYVertices(BufferSalida& buffer, const TGrafo* grafo) {
+		AgregarLinea(buffer, { "Archivo ", URGGrafo::VerNombre(grafo), ".urg del URG (Undav Repositorio de grafos) 2018 Universidad Nacional de Avellaneda" });
+		AgregarLinea(buffer, "# Este archivo puede ser copiado libremente pero por favor no lo modifique!");
+		AgregarLinea(buffer, { "# Identificador: ", URGGrafo::VerIdentificador(grafo) });
+
+		AgregarLinea(buffer, "# Vertices");
+		int cantidadVertices = URGGrafo::ObtenerCantidadVertices(grafo);
+		for (int vertice = 0; vertice < cantidadVertices; ++vertice) {
+			std::string_view etiqueta = EtiquetaSerializable(grafo, vertice);
+			if (!etiqueta.empty()) {
+				AgregarLinea(buffer, { "@v", etiqueta });
+				continue;
+			}
+			char* fin = FormatearVertice(ReservarBuffer(buffer, LARGO_MAXIMO_LINEA), vertice);
+			buffer.usado = static_cast<size_t>(fin - buffer.datos.data());
+		}
+
+		AgregarLinea(buffer, "# Aristas");
+	}
+
+	// Comun a Grafo y GrafoCongelado: ambos exponen las mismas primitivas de lectura.
+	// Las lineas se formatean directamente en un bloque fijo a partir de los recorridos del grafo, sin strings intermedios
+	template <typename TGrafo>
+	static void SerializarGrafo(Serializador* serializador, const TGrafo* grafo) {
+		BufferSalida buffer;
+		buffer.escritor = serializador->escritor;
+		AgregarEncabezadoYVertices(buffer, grafo);
+		URGGrafo::ParaCadaArista(grafo, [&buffer](int verticeOrigen, int verticeDestino) {
+			char* fin = FormatearArista(ReservarBuffer(buffer, LARGO_MAXIMO_LINEA), verticeOrigen, verticeDestino);
+			buffer.usado = static_cast<size_t>(fin - buffer.datos.data());
+		});
+		VaciarBuffer(buffer);
+	}
+
+	static unsigned int HilosDisponibles() {
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	// Cantidad aproximada de entradas de adyacencia que formatea cada tarea de SerializarParalelo
+	const long long ENTRADAS_POR_BLOQUE_PARALELO = 1 << 14;
+
+	/*
+	 * Bloque de aristas ya formateado por un hilo, a la espera de que el hilo llamador lo pase al escritor
+	 */
+	struct RanuraSalida {
+		vector<char> datos;
+		size_t usado = 0;
+		bool lista = false;
+	};
+
+	/*
+	 * Parte las aristas en bloques de vertices consecutivos. @hilos hilos formatean cada uno el siguiente bloque libre en una ranura
+	 * propia (hay 2 * @hilos ranuras) y el hilo llamador las pasa al escritor en el orden de los bloques, asi que la salida
+	 * es la misma que la de SerializarGrafo y la memoria queda acotada por la cantidad de ranuras
+	 */
+	template <typename TGrafo>
+	static void SerializarGrafoParalelo(Serializador* serializador, const TGrafo* grafo, unsigned int hilos) {
+		// Bloques de alrededor de ENTRADAS_POR_BLOQUE_PARALELO entradas. capacidades acota lo que ocupa cada bloque formateado
+		int cantidadVertices = URGGrafo::ObtenerCantidadVertices(grafo);
+		vector<int> limites(1, 0);
+		vector<size_t> capacidades;
+		long long entradas = 0;
+		for (int vertice = 0; vertice < cantidadVertices; ++vertice) {
+			entradas += URGGrafo::ObtenerGrado(grafo, vertice);
+			if (entradas >= ENTRADAS_POR_BLOQUE_PARALELO || vertice == cantidadVertices - 1) {
+				limites.push_back(vertice + 1);
+				capacidades.push_back(static_cast<size_t>(entradas) * LARGO_MAXIMO_LINEA);
+				entradas = 0;
+			}
+		}
+		size_t cantidadBloques = capacidades.size();
+		if (hilos <= 1 || cantidadBloques <= 1) {
+			SerializarGrafo(serializador, grafo);
+			return;
+		}
+
+		BufferSalida buffer;
+		buffer.escritor = serializador->escritor;
+		AgregarEncabezadoYVertices(buffer, grafo);
+		VaciarBuffer(buffer);
+
+		size_t cantidadRanuras = 2 * static_cast<size_t>(hilos);
+		vector<RanuraSalida> ranuras(cantidadRanuras);
+		std::mutex mutex;
+		std::condition_variable cambio;
+		size_t siguienteBloque = 0;
+		size_t bloquesEscritos = 0;
+
+		auto Formatear = [&]() {
+			for (;;) {
+				size_t bloque;
+				{
+					// Un bloque solo se toma cuando ya se escribio el que usaba antes su ranura
+					std::unique_lock<std::mutex> bloqueo(mutex);
+					cambio.wait(bloqueo, [&]() {
+						return siguienteBloque >= cantidadBloques || siguienteBloque < bloquesEscritos + cantidadRanuras;
+					});
+					if (siguienteBloque >= cantidadBloques) {
+						return;
+					}
+					bloque = siguienteBloque++;
+				}
+
+				RanuraSalida& ranura = ranuras[bloque % cantidadRanuras];
+				if (ranura.datos.size() < capacidades[bloque]) {
+					ranura.datos.resize(capacidades[bloque]);
+				}
+				char* cursor = ranura.datos.data();
+				URGGrafo::ParaCadaArista(grafo, limites[bloque], limites[bloque + 1], [&cursor](int verticeOrigen, int verticeDestino) {
+					cursor = FormatearArista(cursor, verticeOrigen, verticeDestino);
+				});
+				{
+					std::lock_guard<std::mutex> bloqueo(mutex);
+					ranura.usado = static_cast<size_t>(cursor - ranura.datos.data());
+					ranura.lista = true;
+				}
+				cambio.notify_all();
+			}
+		};
+
+		vector<std::thread> trabajadores;
+		for (unsigned int i = 0; i < hilos; ++i) {
+			trabajadores.emplace_back(Formatear);
+		}
+		for (size_t bloque = 0; bloque < cantidadBloques; ++bloque) {
+			RanuraSalida& ranura = ranuras[bloque % cantidadRanuras];
+			{
+				std::unique_lock<std::mutex> bloqueo(mutex);
+				cambio.wait(bloqueo, [&ranura]() { return ranura.lista; });
+			}
+			URGEscritor::EscribirBloque(serializador->escritor, ranura.datos.data(), ranura.usado);
+			{
+				std::lock_guard<std::mutex> bloqueo(mutex);
+				ranura.lista = false;
+				bloquesEscritos++;
+			}
+			cambio.notify_all();
+		}
+		for (std::thread& trabajador : trabajadores) {
+			trabajador.join();
+		}
+	}
+
 	/*
 		 * Precondicion: ninguna
 		 * Postcondicion: Serializa el grafo segun el siguiente formato
@@ -49,57 +331,414 @@ namespace URGSerializador {
 		 * [Fin]
 		 * Omitir los tags [Comienzo] y [Fin].
 		 * Respetar el formato dado. Tener en cuenta que los vertices y aristas estan separador por nueva linea.
-		 * Los vertices seran los numeros o las etiquetas (si es que el grafo tiene etiquetas)
+		 * Los vertices seran los numeros o las etiquetas (si es que el grafo tiene etiquetas): un vertice con etiqueta se escribe
+		 * "@v<etiqueta>" y Deserializar se la devuelve. Las etiquetas con saltos de linea o iguales al numero de su vertice
+		 * no se pueden distinguir del formato y se escriben como el numero. Las aristas se escriben siempre con numeros
 		 */
 	void Serializar(Serializador* serializador, const Grafo* grafo) {
+		SerializarGrafo(serializador, grafo);
+	}
 
-		Escribir(serializador->escritor, "Archivo " + URGGrafo::ObtenerNombre(grafo) + ".urg del URG (Undav Repositorio de grafos) 2018 Universidad Nacional de Avellaneda");
-		Escribir(serializador->escritor, "# Este archivo puede ser copiado libremente pero por favor no lo modifique!");
-		Escribir(serializador->escritor, "# Identificador: " + URGGrafo::ObtenerIdentificador(grafo));
-
-		Escribir(serializador->escritor, "# Vertices");
-		//Modificar los vertices en formato CSV <Separados por comas> para que concuerden con la postcondicion
-		string vertices = URGGrafo::ObtenerVertices(grafo);
-		//Lee la cadena como un flujo de datos, investigar mas.
-		std::istringstream stream(vertices);
-		string vertice;
-		//Separa luego de cada coma como si fuera una linea.
-		while (std::getline(stream, vertice, ',')) {
-			Escribir(serializador->escritor, "@v" + vertice);
-		}
-
-		Escribir(serializador->escritor, "# Aristas");
-		//Modificar las aristas en formato CSV para que concuerden con la postcondicion
-		string aristas = URGGrafo::ObtenerAristas(grafo);
-
-		string aristaFormateada;
-		for (char c : aristas) {
-			if (c == ' ') {
-				if (!aristaFormateada.empty()) {
-					Escribir(serializador->escritor, "@" + aristaFormateada);
-					aristaFormateada.clear();
-				}
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo
+		 * Postcondicion: Serializa el grafo congelado con el mismo formato que Serializar(Serializador*, const Grafo*)
+		 */
+	void Serializar(Serializador* serializador, const URGGrafo::GrafoCongelado* grafo) {
+		SerializarGrafo(serializador, grafo);
+	}
+
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CrearGrafoImplicito
+		 * Postcondicion: Serializa el grafo implicito con el mismo formato que Serializar(Serializador*, const Grafo*),
+		 * recorriendo sus aristas sin materializarlo: da los mismos bytes que serializar URGGrafo::MaterializarGrafo(@grafo)
+		 */
+	void Serializar(Serializador* serializador, const URGGrafo::GrafoImplicito* grafo) {
+		SerializarGrafo(serializador, grafo);
+	}
+
+	/*
+		 * Precondicion: @serializador es una instancia valida creada con alguna de las primitivas creacionales
+		 * Postcondicion: Serializa @grafo con el mismo formato y exactamente los mismos bytes que Serializar, formateando
+		 * las aristas en @hilos hilos (0 usa un hilo por nucleo). Los bloques se escriben en orden desde el hilo llamador
+		 */
+	void SerializarParalelo(Serializador* serializador, const Grafo* grafo, unsigned int hilos) {
+		SerializarGrafoParalelo(serializador, grafo, hilos == 0 ? HilosDisponibles() : hilos);
+	}
+
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo o URGGrafo::CargarGrafoBinario
+		 * Postcondicion: Serializa el grafo congelado igual que SerializarParalelo(Serializador*, const Grafo*, unsigned int)
+		 */
+	void SerializarParalelo(Serializador* serializador, const URGGrafo::GrafoCongelado* grafo, unsigned int hilos) {
+		SerializarGrafoParalelo(serializador, grafo, hilos == 0 ? HilosDisponibles() : hilos);
+	}
+
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CrearGrafoImplicito
+		 * Postcondicion: Serializa el grafo implicito igual que SerializarParalelo(Serializador*, const Grafo*, unsigned int),
+		 * sin materializarlo
+		 */
+	void SerializarParalelo(Serializador* serializador, const URGGrafo::GrafoImplicito* grafo, unsigned int hilos) {
+		SerializarGrafoParalelo(serializador, grafo, hilos == 0 ? HilosDisponibles() : hilos);
+	}
+
+	// Escribe ceros hasta dejar @posicion en un multiplo de @alineacion
+	static void Rellenar(std::ofstream& archivo, uint64_t& posicion, uint64_t alineacion) {
+		static const char ceros[8] = {};
+		uint64_t alineada = URGFormatoBinario::Alinear(posicion, alineacion);
+		archivo.write(ceros, static_cast<std::streamsize>(alineada - posicion));
+		posicion = alineada;
+	}
+
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo o URGGrafo::CargarGrafoBinario
+		 * Postcondicion: Escribe @grafo en el archivo @nombreArchivo con el formato binario .urgb. Devuelve false si no pudo escribir el archivo
+		 */
+	bool SerializarBinario(const URGGrafo::GrafoCongelado* grafo, string nombreArchivo) {
+		std::ofstream archivo(nombreArchivo, std::ios::binary | std::ios::trunc);
+		if (!archivo.is_open()) {
+			return false;
+		}
+
+		int cantidadVertices = URGGrafo::ObtenerCantidadVertices(grafo);
+		std::string_view nombre = URGGrafo::VerNombre(grafo);
+		std::string_view identificador = URGGrafo::VerIdentificador(grafo);
+
+		// Primera pasada: largo codificado de cada fila para escribir los offsets antes que las filas
+		vector<uint64_t> offsets(cantidadVertices + 1, 0);
+		uint64_t cantidadEntradas = 0;
+		for (int vertice = 0; vertice < cantidadVertices; ++vertice) {
+			int grado = URGGrafo::ObtenerGrado(grafo, vertice);
+			uint64_t largo = URGFormatoBinario::LargoVarint(static_cast<uint64_t>(grado));
+			int anterior = 0;
+			URGGrafo::ParaCadaAdyacente(grafo, vertice, [&](int vecino) {
+				largo += URGFormatoBinario::LargoVarint(static_cast<uint64_t>(vecino - anterior));
+				anterior = vecino;
+			});
+			offsets[vertice + 1] = offsets[vertice] + largo;
+			cantidadEntradas += static_cast<uint64_t>(grado);
+		}
+
+		// Etiquetas internadas: cada texto distinto se guarda una vez y los vertices guardan su indice
+		vector<uint32_t> etiquetaDeVertice(cantidadVertices, URGFormatoBinario::SIN_ETIQUETA);
+		vector<uint32_t> offsetsEtiquetas(1, 0);
+		string caracteres;
+		std::unordered_map<string, uint32_t> internadas;
+		URGGrafo::ParaCadaVertice(grafo, [&](int vertice, std::string_view etiqueta) {
+			if (etiqueta.empty()) {
+				return;
+			}
+			auto insercion = internadas.emplace(string(etiqueta), static_cast<uint32_t>(offsetsEtiquetas.size() - 1));
+			if (insercion.second) {
+				caracteres.append(etiqueta.data(), etiqueta.size());
+				offsetsEtiquetas.push_back(static_cast<uint32_t>(caracteres.size()));
+			}
+			etiquetaDeVertice[vertice] = insercion.first->second;
+		});
+
+		URGFormatoBinario::Encabezado encabezado = {};
+		std::memcpy(encabezado.magia, URGFormatoBinario::MAGIA, sizeof(encabezado.magia));
+		encabezado.version = URGFormatoBinario::VERSION;
+		encabezado.marcaOrden = URGFormatoBinario::MARCA_ORDEN;
+		encabezado.dirigido = URGGrafo::ObtenerTipo(grafo) == URGGrafo::DIRIGIDO ? 1 : 0;
+		encabezado.cantidadVertices = static_cast<uint32_t>(cantidadVertices);
+		encabezado.largoNombre = static_cast<uint32_t>(nombre.size());
+		encabezado.largoIdentificador = static_cast<uint32_t>(identificador.size());
+		encabezado.cantidadEntradas = cantidadEntradas;
+		encabezado.inicioOffsets = URGFormatoBinario::Alinear(sizeof(encabezado) + nombre.size() + identificador.size(), sizeof(uint64_t));
+		encabezado.inicioFilas = encabezado.inicioOffsets + offsets.size() * sizeof(uint64_t);
+		uint64_t finFilas = encabezado.inicioFilas + offsets[cantidadVertices];
+		encabezado.inicioEtiquetas = internadas.empty() ? 0 : URGFormatoBinario::Alinear(finFilas, sizeof(uint32_t));
+
+		uint64_t posicion = sizeof(encabezado) + nombre.size() + identificador.size();
+		archivo.write(reinterpret_cast<const char*>(&encabezado), sizeof(encabezado));
+		archivo.write(nombre.data(), static_cast<std::streamsize>(nombre.size()));
+		archivo.write(identificador.data(), static_cast<std::streamsize>(identificador.size()));
+		Rellenar(archivo, posicion, sizeof(uint64_t));
+		archivo.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+
+		// Segunda pasada: filas codificadas a traves de un buffer fijo
+		const size_t TAMANIO_BUFFER = 1 << 16;
+		const size_t MAXIMO_VARINT = 10;
+		vector<uint8_t> buffer(TAMANIO_BUFFER);
+		uint8_t* cursor = buffer.data();
+		auto Asegurar = [&]() {
+			if (static_cast<size_t>(buffer.data() + buffer.size() - cursor) < MAXIMO_VARINT) {
+				archivo.write(reinterpret_cast<const char*>(buffer.data()), cursor - buffer.data());
+				cursor = buffer.data();
+			}
+		};
+		for (int vertice = 0; vertice < cantidadVertices; ++vertice) {
+			Asegurar();
+			cursor = URGFormatoBinario::EscribirVarint(cursor, static_cast<uint64_t>(URGGrafo::ObtenerGrado(grafo, vertice)));
+			int anterior = 0;
+			URGGrafo::ParaCadaAdyacente(grafo, vertice, [&](int vecino) {
+				Asegurar();
+				cursor = URGFormatoBinario::EscribirVarint(cursor, static_cast<uint64_t>(vecino - anterior));
+				anterior = vecino;
+			});
+		}
+		archivo.write(reinterpret_cast<const char*>(buffer.data()), cursor - buffer.data());
+
+		if (!internadas.empty()) {
+			posicion = finFilas;
+			Rellenar(archivo, posicion, sizeof(uint32_t));
+			uint32_t cantidadEtiquetas = static_cast<uint32_t>(offsetsEtiquetas.size() - 1);
+			archivo.write(reinterpret_cast<const char*>(&cantidadEtiquetas), sizeof(cantidadEtiquetas));
+			archivo.write(reinterpret_cast<const char*>(offsetsEtiquetas.data()), static_cast<std::streamsize>(offsetsEtiquetas.size() * sizeof(uint32_t)));
+			archivo.write(reinterpret_cast<const char*>(etiquetaDeVertice.data()), static_cast<std::streamsize>(etiquetaDeVertice.size() * sizeof(uint32_t)));
+			archivo.write(caracteres.data(), static_cast<std::streamsize>(caracteres.size()));
+		}
+
+		archivo.close();
+		return !archivo.fail();
+	}
+
+	/*
+		 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+		 * Postcondicion: Escribe @grafo en el archivo @nombreArchivo con el formato binario .urgb (ver FormatoBinario.h):
+		 * encabezado fijo, adyacencia CSR con vecinos ordenados codificados por diferencias en varint y etiquetas internadas.
+		 * Se lee con URGGrafo::CargarGrafoBinario. Devuelve false si no pudo escribir el archivo
+		 */
+	bool SerializarBinario(const Grafo* grafo, string nombreArchivo) {
+		// El formato necesita las filas ordenadas: se escriben desde una copia congelada
+		URGGrafo::GrafoCongelado* congelado = URGGrafo::CongelarGrafo(grafo);
+		bool escrito = SerializarBinario(congelado, nombreArchivo);
+		URGGrafo::DestruirGrafo(congelado);
+		return escrito;
+	}
+
+	// A partir de este tamanio la seccion de aristas se divide en trozos que se leen en varios hilos
+	const size_t MINIMO_BYTES_ARISTAS_PARALELO = 1 << 20;
+
+	/*
+	 * Devuelve la linea que empieza en @inicio (sin el salto de linea ni un '\r' final) y deja @inicio en la siguiente.
+	 * Los saltos se buscan con memchr, que la biblioteca estandar resuelve con instrucciones vectoriales
+	 */
+	static std::string_view SiguienteLinea(const char*& inicio, const char* fin) {
+		const char* salto = static_cast<const char*>(std::memchr(inicio, '\n', fin - inicio));
+		const char* finLinea = salto ? salto : fin;
+		std::string_view linea(inicio, finLinea - inicio);
+		inicio = salto ? salto + 1 : fin;
+		if (!linea.empty() && linea.back() == '\r') {
+			linea.remove_suffix(1);
+		}
+		return linea;
+	}
+
+	/*
+	 * Devuelve el vertice que nombra @texto: su numero o, si no es un numero, el vertice de @grafo con esa etiqueta (-1 si no hay)
+	 */
+	static int ResolverVertice(std::string_view texto, const Grafo* grafo) {
+		int vertice;
+		const char* fin = texto.data() + texto.size();
+		auto leido = std::from_chars(texto.data(), fin, vertice);
+		if (!texto.empty() && leido.ec == std::errc() && leido.ptr == fin) {
+			return vertice;
+		}
+		return URGGrafo::ObtenerVerticePorEtiqueta(grafo, texto);
+	}
+
+	/*
+	 * Lee una linea de arista "@origen-destino". Si los extremos no son numeros los busca como etiquetas de @grafo,
+	 * probando cada '-' como separador. Devuelve false si la linea no es una arista
+	 */
+	static bool LeerArista(std::string_view linea, const Grafo* grafo, std::pair<int, int>& arista) {
+		if (linea.size() < 4 || linea[0] != '@') {
+			return false;
+		}
+		const char* fin = linea.data() + linea.size();
+		auto origen = std::from_chars(linea.data() + 1, fin, arista.first);
+		if (origen.ec == std::errc() && origen.ptr < fin && *origen.ptr == '-') {
+			auto destino = std::from_chars(origen.ptr + 1, fin, arista.second);
+			if (destino.ec == std::errc() && destino.ptr == fin) {
+				return true;
+			}
+		}
+
+		linea.remove_prefix(1);
+		for (size_t guion = linea.find('-'); guion != std::string_view::npos; guion = linea.find('-', guion + 1)) {
+			arista.first = ResolverVertice(linea.substr(0, guion), grafo);
+			arista.second = ResolverVertice(linea.substr(guion + 1), grafo);
+			if (arista.first >= 0 && arista.second >= 0) {
+				return true;
 			}
-			else {
-				aristaFormateada += c;
+		}
+		return false;
+	}
+
+	/*
+	 * Lee las aristas de [@inicio, @fin), que empieza y termina en un limite de linea. Devuelve false si alguna linea no es una arista
+	 */
+	static bool LeerAristas(const char* inicio, const char* fin, const Grafo* grafo, vector<std::pair<int, int>>& aristas) {
+		std::pair<int, int> arista;
+		while (inicio < fin) {
+			std::string_view linea = SiguienteLinea(inicio, fin);
+			if (linea.empty()) {
+				continue;
+			}
+			if (!LeerArista(linea, grafo, arista)) {
+				return false;
+			}
+			aristas.push_back(arista);
+		}
+		return true;
+	}
+
+	/*
+		 * Precondicion: -
+		 * Postcondicion: Lee un archivo escrito con Serializar y devuelve una instancia nueva de Grafo de tipo @tipo
+		 * (el formato .urg no guarda si el grafo es dirigido) con el nombre, los vertices, las etiquetas y las aristas del archivo.
+		 * El grafo recibe un identificador unico nuevo. Las aristas con vertices que no estan en la seccion de vertices se ignoran,
+		 * igual que en Conectar. Si el archivo no existe o no respeta el formato devuelve NULL
+		 */
+	Grafo* Deserializar(string nombreArchivo, URGGrafo::TipoGrafo tipo) {
+		URGArchivoMapeado::ArchivoMapeado* archivo = URGArchivoMapeado::MapearArchivo(nombreArchivo);
+		if (archivo == nullptr) {
+			return nullptr;
+		}
+		const char* cursor = URGArchivoMapeado::ObtenerDatos(archivo);
+		const char* fin = cursor + URGArchivoMapeado::ObtenerTamanio(archivo);
+
+		// Encabezado: el nombre sale de la linea "Archivo <nombre>.urg del URG ..."
+		string nombre;
+		std::string_view linea;
+		const std::string_view PREFIJO_NOMBRE = "Archivo ";
+		const std::string_view SUFIJO_NOMBRE = ".urg del URG";
+		while (cursor < fin && (linea = SiguienteLinea(cursor, fin)) != "# Vertices") {
+			size_t sufijo = linea.rfind(SUFIJO_NOMBRE);
+			if (nombre.empty() && linea.substr(0, PREFIJO_NOMBRE.size()) == PREFIJO_NOMBRE && sufijo != std::string_view::npos) {
+				nombre = string(linea.substr(PREFIJO_NOMBRE.size(), sufijo - PREFIJO_NOMBRE.size()));
 			}
 		}
+		if (linea != "# Vertices") {
+			URGArchivoMapeado::DestruirArchivoMapeado(archivo);
+			return nullptr;
+		}
 
-		if (!aristaFormateada.empty()) {
-			Escribir(serializador->escritor, "@" + aristaFormateada);
+		// Vertices: el i-esimo "@v..." es el vertice i. Si el texto no es el numero del vertice, es su etiqueta
+		vector<std::pair<int, std::string_view>> etiquetas;
+		int cantidadVertices = 0;
+		bool valido = false;
+		while (cursor < fin) {
+			linea = SiguienteLinea(cursor, fin);
+			if (linea == "# Aristas") {
+				valido = true;
+				break;
+			}
+			if (linea.empty()) {
+				continue;
+			}
+			if (linea.size() < 3 || linea[0] != '@' || linea[1] != 'v') {
+				break;
+			}
+			int numero;
+			const char* finTexto = linea.data() + linea.size();
+			auto leido = std::from_chars(linea.data() + 2, finTexto, numero);
+			if (leido.ec != std::errc() || leido.ptr != finTexto || numero != cantidadVertices) {
+				etiquetas.emplace_back(cantidadVertices, linea.substr(2));
+			}
+			cantidadVertices++;
 		}
+		if (!valido) {
+			URGArchivoMapeado::DestruirArchivoMapeado(archivo);
+			return nullptr;
+		}
+
+		Grafo* grafo = tipo == URGGrafo::DIRIGIDO ? URGGrafo::CrearGrafoDirigido(std::move(nombre), cantidadVertices)
+			: URGGrafo::CrearGrafoNoDirigido(std::move(nombre), cantidadVertices);
+		for (const auto& etiqueta : etiquetas) {
+			URGGrafo::AgregarEtiqueta(grafo, etiqueta.first, etiqueta.second);
+		}
+
+		// Aristas: en archivos grandes se parten en trozos que terminan en un salto de linea y se leen en paralelo
+		size_t bytesAristas = static_cast<size_t>(fin - cursor);
+		unsigned int hilos = bytesAristas >= MINIMO_BYTES_ARISTAS_PARALELO ? HilosDisponibles() : 1;
+		vector<const char*> limites(1, cursor);
+		for (unsigned int i = 1; i < hilos; ++i) {
+			const char* corte = std::max(limites.back(), cursor + bytesAristas / hilos * i);
+			const char* salto = static_cast<const char*>(std::memchr(corte, '\n', fin - corte));
+			limites.push_back(salto ? salto + 1 : fin);
+		}
+		limites.push_back(fin);
+
+		size_t trozos = limites.size() - 1;
+		vector<vector<std::pair<int, int>>> aristasPorTrozo(trozos);
+		std::unique_ptr<bool[]> trozoValido(new bool[trozos]);
+		auto LeerTrozo = [&](size_t trozo) {
+			// Estimacion de una arista cada 8 bytes para no realocar mientras se lee
+			aristasPorTrozo[trozo].reserve(static_cast<size_t>(limites[trozo + 1] - limites[trozo]) / 8);
+			trozoValido[trozo] = LeerAristas(limites[trozo], limites[trozo + 1], grafo, aristasPorTrozo[trozo]);
+		};
+		if (trozos == 1) {
+			LeerTrozo(0);
+		}
+		else {
+			vector<std::thread> trabajadores;
+			for (size_t trozo = 0; trozo < trozos; ++trozo) {
+				trabajadores.emplace_back(LeerTrozo, trozo);
+			}
+			for (std::thread& trabajador : trabajadores) {
+				trabajador.join();
+			}
+		}
+		URGArchivoMapeado::DestruirArchivoMapeado(archivo);
+
+		size_t cantidadAristas = 0;
+		for (size_t trozo = 0; trozo < trozos; ++trozo) {
+			if (!trozoValido[trozo]) {
+				URGGrafo::DestruirGrafo(grafo);
+				return nullptr;
+			}
+			cantidadAristas += aristasPorTrozo[trozo].size();
+		}
+
+		// Una sola carga con el espacio exacto de cada vertice, en el orden del archivo
+		if (trozos == 1) {
+			URGGrafo::ConectarLote(grafo, aristasPorTrozo[0].data(), cantidadAristas);
+		}
+		else {
+			vector<std::pair<int, int>> aristas;
+			aristas.reserve(cantidadAristas);
+			for (vector<std::pair<int, int>>& trozo : aristasPorTrozo) {
+				aristas.insert(aristas.end(), trozo.begin(), trozo.end());
+				vector<std::pair<int, int>>().swap(trozo);
+			}
+			URGGrafo::ConectarLote(grafo, aristas.data(), aristas.size());
+		}
+		return grafo;
 	}
 
 	/*
 		 * Precondiciones: @serializador es una instancia valida creada con alguna de las primitivas creacionales
-		 * Postcondiciones: Libera todos los recursos asociados a @serializador
+		 * Postcondiciones: Libera todos los recursos asociados a @serializador. Si el serializador se creo con CrearSerializador(std::string_view) tambien destruye su escritor;
+		 * el escritor pasado a CrearSerializador(Escritor*) queda a cargo del llamador
 		 */
 	void DestruirSerializador(Serializador* serializador) {
 		if (serializador != nullptr) {
-			if (serializador->escritor != nullptr) {
+			// El escritor recibido en CrearSerializador(Escritor*) sigue siendo del llamador
+			if (serializador->propietario && serializador->escritor != nullptr) {
 				URGEscritor::Destruir(serializador->escritor);
 			}
 			delete serializador;
 		}
 	}
-}
\ No newline at end of file
+
+	/*
+	 * Precondicion: @escritor es una instancia valida
+	 * Postcondicion: Igual que CrearSerializador(Escritor*) pero el serializador queda a cargo del SerializadorUnico
+	 * devuelto. @escritor sigue siendo del llamador y tiene que vivir mas que el serializador
+	 */
+	SerializadorUnico CrearSerializadorUnico(Escritor* escritor) {
+		return SerializadorUnico(CrearSerializador(escritor));
+	}
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Igual que CrearSerializador(std::string_view) pero el serializador, y con el su escritor,
+	 * quedan a cargo del SerializadorUnico devuelto
+	 */
+	SerializadorUnico CrearSerializadorUnico(std::string_view nombreGrafo) {
+		return SerializadorUnico(CrearSerializador(nombreGrafo));
+	}
+}
\ No newline at end of file
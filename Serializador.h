@@ -2,7 +2,9 @@
 #define SERIALIZADORGRAFO_H_
 #include "Escritor.h"
 #include "Grafo.h"
+#include <memory>
 #include <string>
+#include <string_view>
 
 using URGEscritor::Escritor;
 using std::string;
@@ -23,7 +25,7 @@ namespace URGSerializador{
 	 * que tendra como nombre el siguiente: [@nombreGrafo].urg es decir el nombre del grafo con la extencion .urg
 	 * Si no puede crear un escritor de archivo con ese nombre, devuelve NULL
 	 */
-	Serializador* CrearSerializador(string nombreGrafo);
+	Serializador* CrearSerializador(std::string_view nombreGrafo);
 
 	/*
 	 * Precondicion: ninguna
@@ -42,15 +44,98 @@ namespace URGSerializador{
 	 * [Fin]
 	 * Omitir los tags [Comienzo] y [Fin].
 	 * Respetar el formato dado. Tener en cuenta que los vertices y aristas estan separador por nueva linea.
-	 * Los vertices seran los numeros o las etiquetas (si es que el grafo tiene etiquetas)
+	 * Los vertices seran los numeros o las etiquetas (si es que el grafo tiene etiquetas): un vertice con etiqueta se escribe
+	 * "@v<etiqueta>" y Deserializar se la devuelve. Las etiquetas con saltos de linea o iguales al numero de su vertice
+	 * no se pueden distinguir del formato y se escriben como el numero. Las aristas se escriben siempre con numeros
 	 */
 	void Serializar(Serializador* serializador, const Grafo* grafo);
 
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo
+	 * Postcondicion: Serializa el grafo congelado con el mismo formato que Serializar(Serializador*, const Grafo*)
+	 */
+	void Serializar(Serializador* serializador, const URGGrafo::GrafoCongelado* grafo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CrearGrafoImplicito
+	 * Postcondicion: Serializa el grafo implicito con el mismo formato que Serializar(Serializador*, const Grafo*),
+	 * recorriendo sus aristas sin materializarlo: da los mismos bytes que serializar URGGrafo::MaterializarGrafo(@grafo)
+	 */
+	void Serializar(Serializador* serializador, const URGGrafo::GrafoImplicito* grafo);
+
+	/*
+	 * Precondicion: @serializador es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Serializa @grafo con el mismo formato y exactamente los mismos bytes que Serializar, formateando
+	 * las aristas en @hilos hilos (0 usa un hilo por nucleo). Los bloques se escriben en orden desde el hilo llamador
+	 */
+	void SerializarParalelo(Serializador* serializador, const Grafo* grafo, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo o URGGrafo::CargarGrafoBinario
+	 * Postcondicion: Serializa el grafo congelado igual que SerializarParalelo(Serializador*, const Grafo*, unsigned int)
+	 */
+	void SerializarParalelo(Serializador* serializador, const URGGrafo::GrafoCongelado* grafo, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CrearGrafoImplicito
+	 * Postcondicion: Serializa el grafo implicito igual que SerializarParalelo(Serializador*, const Grafo*, unsigned int),
+	 * sin materializarlo
+	 */
+	void SerializarParalelo(Serializador* serializador, const URGGrafo::GrafoImplicito* grafo, unsigned int hilos = 0);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con alguna de las primitivas creacionales
+	 * Postcondicion: Escribe @grafo en el archivo @nombreArchivo con el formato binario .urgb (ver FormatoBinario.h):
+	 * encabezado fijo, adyacencia CSR con vecinos ordenados codificados por diferencias en varint y etiquetas internadas.
+	 * Se lee con URGGrafo::CargarGrafoBinario. Devuelve false si no pudo escribir el archivo
+	 */
+	bool SerializarBinario(const Grafo* grafo, string nombreArchivo);
+
+	/*
+	 * Precondicion: @grafo es una instancia valida creada con URGGrafo::CongelarGrafo o URGGrafo::CargarGrafoBinario
+	 * Postcondicion: Escribe @grafo en el archivo @nombreArchivo con el formato binario .urgb. Devuelve false si no pudo escribir el archivo
+	 */
+	bool SerializarBinario(const URGGrafo::GrafoCongelado* grafo, string nombreArchivo);
+
+	/*
+	 * Precondicion: -
+	 * Postcondicion: Lee un archivo escrito con Serializar y devuelve una instancia nueva de Grafo de tipo @tipo
+	 * (el formato .urg no guarda si el grafo es dirigido) con el nombre, los vertices, las etiquetas y las aristas del archivo.
+	 * El grafo recibe un identificador unico nuevo. Las aristas con vertices que no estan en la seccion de vertices se ignoran,
+	 * igual que en Conectar. Si el archivo no existe o no respeta el formato devuelve NULL
+	 */
+	Grafo* Deserializar(string nombreArchivo, URGGrafo::TipoGrafo tipo = URGGrafo::NODIRIGIDO);
+
 	/*
 	 * Precondiciones: @serializador es una instancia valida creada con alguna de las primitivas creacionales
-	 * Postcondiciones: Libera todos los recursos asociados a @serializador
+	 * Postcondiciones: Libera todos los recursos asociados a @serializador. Si el serializador se creo con CrearSerializador(std::string_view) tambien destruye su escritor;
+	 * el escritor pasado a CrearSerializador(Escritor*) queda a cargo del llamador
 	 */
 	void DestruirSerializador(Serializador* serializador);
+
+	/*
+	 * Destructor para std::unique_ptr: llama a DestruirSerializador
+	 */
+	struct DestructorSerializador {
+		void operator()(Serializador* serializador) const { DestruirSerializador(serializador); }
+	};
+
+	// Serializador que se destruye solo al salir de alcance. get() da el puntero que reciben las demas primitivas
+	typedef std::unique_ptr<Serializador, DestructorSerializador> SerializadorUnico;
+
+	/*
+	 * Precondicion: @escritor es una instancia valida
+	 * Postcondicion: Igual que CrearSerializador(Escritor*) pero el serializador queda a cargo del SerializadorUnico
+	 * devuelto. @escritor sigue siendo del llamador y tiene que vivir mas que el serializador
+	 */
+	SerializadorUnico CrearSerializadorUnico(Escritor* escritor);
+
+	/*
+	 * Precondicion: ninguna
+	 * Postcondicion: Igual que CrearSerializador(std::string_view) pero el serializador, y con el su escritor,
+	 * quedan a cargo del SerializadorUnico devuelto
+	 */
+	SerializadorUnico CrearSerializadorUnico(std::string_view nombreGrafo);
 }
 
 #endif